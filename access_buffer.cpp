@@ -0,0 +1,182 @@
+/**
+*
+* @file access_buffer.cpp - Implementation of the striped hit buffer
+*
+* 10/18/26 - Created
+*/
+
+#include <climits>
+#include <new>
+#include <thread>
+#include "access_buffer.h"
+
+const long long AccessBuffer::EMPTY_SLOT = LLONG_MIN;
+
+// Threads are numbered in the order they first record a hit; consecutive numbers map to different stripes
+static std::atomic<unsigned> nextThreadNumber(0);
+
+/**
+*
+* threadNumber
+*
+* function to return the calling thread's number, assigning one on its first call
+*
+* @param    none
+*
+* @return   the thread's number
+*/
+static unsigned threadNumber() {
+    thread_local unsigned number = nextThreadNumber.fetch_add(1, std::memory_order_relaxed);
+    return number;
+}
+
+AccessBuffer::AccessBuffer(int stripeCount, std::pmr::memory_resource* resource) : pending(false), drainDue(false), memoryResource(resource) {
+    if (stripeCount <= 0) {
+        stripeCount = (int)std::thread::hardware_concurrency();
+    }
+
+    this->stripeCount = 1;
+    while (this->stripeCount < stripeCount) {
+        this->stripeCount *= 2;
+    }
+
+    stripes = allocateArray<Stripe>(memoryResource, this->stripeCount);
+    for (int i = 0; i < this->stripeCount; i++) {
+        Stripe* stripe = new (&stripes[i]) Stripe();
+        for (int slot = 0; slot < STRIPE_SLOTS; slot++) {
+            stripe->slots[slot].store(EMPTY_SLOT, std::memory_order_relaxed);
+        }
+        stripe->writeCount.store(0, std::memory_order_relaxed);
+        stripe->readCount.store(0, std::memory_order_relaxed);
+    }
+}
+
+AccessBuffer::~AccessBuffer() {
+    deallocateArray(memoryResource, stripes, stripeCount);
+}
+
+/**
+*
+* getCapacity
+*
+* Method to return the most keys the buffer holds at once
+*
+* @param    none
+*
+* @return   stripes * STRIPE_SLOTS
+*/
+int AccessBuffer::getCapacity() const {
+    return stripeCount * STRIPE_SLOTS;
+}
+
+/**
+*
+* record
+*
+* Method to record a hit on curKey in the calling thread's stripe; safe to call from any
+* number of threads at once
+*
+* @param    curKey  key that was hit
+*
+* @return   true if the key was recorded, false if it was dropped
+*/
+bool AccessBuffer::record(int curKey) {
+    Stripe& stripe = stripes[threadNumber() & (stripeCount - 1)];
+
+    unsigned readCount = stripe.readCount.load(std::memory_order_acquire);
+    unsigned writeCount = stripe.writeCount.load(std::memory_order_relaxed);
+
+    // A full stripe, or a slot another writer won, drops the hit rather than waiting
+    if (writeCount - readCount >= (unsigned)STRIPE_SLOTS || !stripe.writeCount.compare_exchange_strong(writeCount, writeCount + 1, std::memory_order_relaxed)) {
+        if (!drainDue.load(std::memory_order_relaxed)) {
+            drainDue.store(true, std::memory_order_relaxed);
+        }
+        return false;
+    }
+
+    // Release pairs with drain's acquire, so the reader sees the key once it sees the slot filled
+    stripe.slots[writeCount & (STRIPE_SLOTS - 1)].store(curKey, std::memory_order_release);
+
+    // Checked before storing so that busy readers do not keep writing the shared flags' cache line
+    if (!pending.load(std::memory_order_relaxed)) {
+        pending.store(true, std::memory_order_relaxed);
+    }
+    if (writeCount + 1 - readCount == (unsigned)STRIPE_SLOTS && !drainDue.load(std::memory_order_relaxed)) {
+        drainDue.store(true, std::memory_order_relaxed);
+    }
+
+    return true;
+}
+
+/**
+*
+* hasPending
+*
+* Method to check if any key has been recorded since the last drain
+*
+* @param    none
+*
+* @return   true if a drain would return keys (or may, while a record is under way)
+*/
+bool AccessBuffer::hasPending() const {
+    return pending.load(std::memory_order_relaxed);
+}
+
+/**
+*
+* isDrainDue
+*
+* Method to check if a stripe has filled since the last drain, so hits are being dropped
+*
+* @param    none
+*
+* @return   true if the buffer should be drained
+*/
+bool AccessBuffer::isDrainDue() const {
+    return drainDue.load(std::memory_order_relaxed);
+}
+
+/**
+*
+* drain
+*
+* Method to take every recorded key out of the buffer, stripe by stripe, each stripe in
+* the order its keys were recorded; only one thread may drain at a time
+*
+* @param    keys    array of getCapacity() keys to fill
+*
+* @return   number of keys taken
+*/
+int AccessBuffer::drain(int* keys) {
+    // Cleared first: a key recorded while the stripes are being read sets them again
+    pending.store(false, std::memory_order_relaxed);
+    drainDue.store(false, std::memory_order_relaxed);
+
+    int taken = 0;
+
+    for (int i = 0; i < stripeCount; i++) {
+        Stripe& stripe = stripes[i];
+        unsigned readCount = stripe.readCount.load(std::memory_order_relaxed);
+        unsigned writeCount = stripe.writeCount.load(std::memory_order_acquire);
+
+        // A slot that is claimed but still empty belongs to a writer that has not stored yet;
+        // the keys after it wait for the next drain so that the ring stays in order
+        while (readCount != writeCount) {
+            std::atomic<long long>& slot = stripe.slots[readCount & (STRIPE_SLOTS - 1)];
+            long long key = slot.load(std::memory_order_acquire);
+            if (key == EMPTY_SLOT) {
+                pending.store(true, std::memory_order_relaxed);
+                break;
+            }
+
+            keys[taken++] = (int)key;
+            slot.store(EMPTY_SLOT, std::memory_order_relaxed);
+            readCount++;
+        }
+
+        // Release: a writer that sees the new read count also sees the emptied slots
+        stripe.readCount.store(readCount, std::memory_order_release);
+    }
+
+    return taken;
+}
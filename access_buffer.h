@@ -0,0 +1,114 @@
+/**
+*
+* access_buffer.h : This is the header file for access_buffer.cpp.
+*
+* 10/18/26 - Created; striped, lossy ring buffers of hit keys, drained in batches by CacheManager
+*/
+
+#ifndef _ACCESS_BUFFER
+#define _ACCESS_BUFFER
+
+#include <atomic>
+#include "memory_resources.h"
+
+// Define a class that collects the keys of cache hits from many threads until one thread drains them
+//
+// A cache whose policy relinks an entry on every hit needs the writer's lock for every hit.
+// Instead, a reader can look the key up under a shared lock and record it here; the next
+// holder of the exclusive lock drains every recorded key and applies the hits in one batch.
+// The buffer is split into stripes of STRIPE_SLOTS keys, and each thread records into the
+// stripe picked by its thread number, so threads rarely share a ring. A stripe is a bounded
+// ring with any number of writers and one reader: a writer claims a slot by advancing the
+// write count, then stores its key; the reader takes keys up to the first slot not yet stored.
+// Recording never waits: a key is dropped when its stripe is full or another thread claimed
+// the same slot first. Dropped hits only make recency approximate, which eviction tolerates.
+class AccessBuffer {
+private:
+	static const int STRIPE_SLOTS = 16;		// keys per stripe; a power of two
+	static const long long EMPTY_SLOT;		// value of a slot with no key; outside the int range
+
+	struct alignas(64) Stripe {
+		std::atomic<long long> slots[STRIPE_SLOTS];
+		std::atomic<unsigned> writeCount;	// slots claimed by writers, ever
+		std::atomic<unsigned> readCount;	// slots taken by the reader, ever
+	};
+
+	Stripe* stripes;				// one cache-line-aligned ring per stripe
+	int stripeCount;				// a power of two
+	std::atomic<bool> pending;		// set when a key is recorded, cleared by drain
+	std::atomic<bool> drainDue;		// set when a stripe fills or drops a key, cleared by drain
+
+	std::pmr::memory_resource* memoryResource;	// source of the stripes; nullptr = new/delete
+
+public:
+	// Constructor makes stripeCount stripes, rounded up to a power of two; 0 means one per hardware
+	// thread. The stripes come from resource (new/delete if null).
+	AccessBuffer(int stripeCount, std::pmr::memory_resource* resource = nullptr);
+
+	// Destructor frees the stripes
+	~AccessBuffer();
+
+	/**
+	*
+	* getCapacity
+	*
+	* Method to return the most keys the buffer holds at once
+	*
+	* @param    none
+	*
+	* @return   stripes * STRIPE_SLOTS
+	*/
+	int getCapacity() const;
+
+	/**
+	*
+	* record
+	*
+	* Method to record a hit on curKey in the calling thread's stripe; safe to call from any
+	* number of threads at once
+	*
+	* @param    curKey  key that was hit
+	*
+	* @return   true if the key was recorded, false if it was dropped
+	*/
+	bool record(int curKey);
+
+	/**
+	*
+	* hasPending
+	*
+	* Method to check if any key has been recorded since the last drain
+	*
+	* @param    none
+	*
+	* @return   true if a drain would return keys (or may, while a record is under way)
+	*/
+	bool hasPending() const;
+
+	/**
+	*
+	* isDrainDue
+	*
+	* Method to check if a stripe has filled since the last drain, so hits are being dropped
+	*
+	* @param    none
+	*
+	* @return   true if the buffer should be drained
+	*/
+	bool isDrainDue() const;
+
+	/**
+	*
+	* drain
+	*
+	* Method to take every recorded key out of the buffer, stripe by stripe, each stripe in
+	* the order its keys were recorded; only one thread may drain at a time
+	*
+	* @param    keys    array of getCapacity() keys to fill
+	*
+	* @return   number of keys taken
+	*/
+	int drain(int* keys);
+};
+
+#endif
@@ -0,0 +1,1133 @@
+/**
+*
+* @file bplus_tree.cpp - Implementation of the B+tree ordered index
+*
+* 10/18/26 - Created
+* 10/18/26 - Inner nodes count the keys under each child; added subtreeSize, countBelow, rank, select and countInRange
+* 10/18/26 - Added seekRange and stepRange for RangeCursor
+* 10/18/26 - Added attachSorted, a bottom-up bulk build
+*/
+
+#include <algorithm>
+#include <queue>
+#include <string>
+#include <vector>
+#include "bplus_tree.h"
+
+extern void logToFileAndConsole(std::string message);
+
+// A node other than the root never has fewer keys than these; a merge of a node one under the
+// minimum with a sibling at the minimum (plus the separator, for inner nodes) always fits
+static const int LEAF_MIN_KEYS = BPlusLeafNode::CAPACITY / 2;
+static const int INNER_MIN_KEYS = BPlusInnerNode::CAPACITY / 2;
+
+/**
+*
+* childIndex
+*
+* function to pick the child of an inner node whose range covers key
+*
+* @param    inner   an inner node
+* @param    key     key to look for
+*
+* @return   index of the child: the number of separators <= key
+*/
+static int childIndex(const BPlusInnerNode* inner, int key) {
+    return (int)(std::upper_bound(inner->keys, inner->keys + inner->count, key) - inner->keys);
+}
+
+/**
+*
+* leafIndex
+*
+* function to find where key is, or would go, in a leaf
+*
+* @param    leaf    a leaf
+* @param    key     key to look for
+*
+* @return   index of the first key >= key
+*/
+static int leafIndex(const BPlusLeafNode* leaf, int key) {
+    return (int)(std::lower_bound(leaf->keys, leaf->keys + leaf->count, key) - leaf->keys);
+}
+
+/**
+*
+* subtreeSize
+*
+* function to count the keys under a node
+*
+* @param    node    a node whose own counts are up to date
+*
+* @return   number of keys in the node's subtree
+*/
+static int subtreeSize(const BPlusNode* node) {
+    if (node->leaf) {
+        return node->count;
+    }
+
+    const BPlusInnerNode* inner = static_cast<const BPlusInnerNode*>(node);
+    int total = 0;
+    for (int i = 0; i <= inner->count; i++) {
+        total += inner->counts[i];
+    }
+    return total;
+}
+
+BPlusTree::BPlusTree(std::pmr::memory_resource* resource) : root(nullptr), firstLeaf(nullptr), lastLeaf(nullptr), size(0), innerNodeCount(0), leafNodeCount(0), memoryResource(resource) {}
+
+BPlusTree::~BPlusTree() {
+    detachAll();
+}
+
+/**
+*
+* newLeaf
+*
+* Method to allocate an empty leaf
+*
+* @param    none
+*
+* @return   the leaf
+*/
+BPlusLeafNode* BPlusTree::newLeaf() {
+    BPlusLeafNode* leaf = newObject<BPlusLeafNode>(memoryResource);
+    leaf->count = 0;
+    leaf->leaf = true;
+    leaf->prev = nullptr;
+    leaf->next = nullptr;
+    leafNodeCount++;
+    return leaf;
+}
+
+/**
+*
+* newInner
+*
+* Method to allocate an empty inner node
+*
+* @param    none
+*
+* @return   the inner node
+*/
+BPlusInnerNode* BPlusTree::newInner() {
+    BPlusInnerNode* inner = newObject<BPlusInnerNode>(memoryResource);
+    inner->count = 0;
+    inner->leaf = false;
+    innerNodeCount++;
+    return inner;
+}
+
+/**
+*
+* freeNode
+*
+* Method to free one node, inner or leaf
+*
+* @param    node    node to free
+*
+* @return   nothing
+*/
+void BPlusTree::freeNode(BPlusNode* node) {
+    if (node->leaf) {
+        deleteObject(memoryResource, static_cast<BPlusLeafNode*>(node));
+        leafNodeCount--;
+    } else {
+        deleteObject(memoryResource, static_cast<BPlusInnerNode*>(node));
+        innerNodeCount--;
+    }
+}
+
+/**
+*
+* freeSubtree
+*
+* Method to free a node and everything below it
+*
+* @param    node    root of the subtree
+*
+* @return   nothing
+*/
+void BPlusTree::freeSubtree(BPlusNode* node) {
+    if (!node->leaf) {
+        BPlusInnerNode* inner = static_cast<BPlusInnerNode*>(node);
+        for (int i = 0; i <= inner->count; i++) {
+            freeSubtree(inner->children[i]);
+        }
+    }
+
+    freeNode(node);
+}
+
+/**
+*
+* findLeaf
+*
+* Method to descend to the leaf whose range covers key
+*
+* @param    key     key to look for
+*
+* @return   that leaf; the tree must not be empty
+*/
+BPlusLeafNode* BPlusTree::findLeaf(int key) const {
+    BPlusNode* node = root;
+
+    while (!node->leaf) {
+        BPlusInnerNode* inner = static_cast<BPlusInnerNode*>(node);
+        node = inner->children[childIndex(inner, key)];
+    }
+
+    return static_cast<BPlusLeafNode*>(node);
+}
+
+/**
+*
+* insert
+*
+* Method to map key to fifoNode unless key is already present
+*
+* @param    key         key to add
+* @param    fifoNode    FIFO node for key
+*
+* @return   true if key was added, false if it was already present (its node is left unchanged)
+*/
+bool BPlusTree::insert(int key, DllNode* fifoNode) {
+    if (root == nullptr) {
+        BPlusLeafNode* leaf = newLeaf();
+        leaf->keys[0] = key;
+        leaf->values[0] = fifoNode;
+        leaf->count = 1;
+        root = leaf;
+        firstLeaf = leaf;
+        lastLeaf = leaf;
+        size = 1;
+        return true;
+    }
+
+    // The path is kept so a split can be pushed up without parent pointers
+    BPlusInnerNode* path[MAX_DEPTH];
+    int slots[MAX_DEPTH];
+    int depth = 0;
+
+    BPlusNode* node = root;
+    while (!node->leaf) {
+        BPlusInnerNode* inner = static_cast<BPlusInnerNode*>(node);
+        int slot = childIndex(inner, key);
+        path[depth] = inner;
+        slots[depth] = slot;
+        depth++;
+        node = inner->children[slot];
+    }
+
+    BPlusLeafNode* leaf = static_cast<BPlusLeafNode*>(node);
+    int position = leafIndex(leaf, key);
+    if (position < leaf->count && leaf->keys[position] == key) {
+        return false;
+    }
+
+    size++;
+    for (int d = 0; d < depth; d++) {
+        path[d]->counts[slots[d]]++;
+    }
+
+    if (leaf->count == BPlusLeafNode::CAPACITY) {
+        // Split into two half-full leaves, then insert into whichever half key belongs to
+        BPlusLeafNode* right = newLeaf();
+        int half = BPlusLeafNode::CAPACITY / 2;
+
+        std::copy(leaf->keys + half, leaf->keys + leaf->count, right->keys);
+        std::copy(leaf->values + half, leaf->values + leaf->count, right->values);
+        right->count = leaf->count - half;
+        leaf->count = half;
+
+        right->next = leaf->next;
+        right->prev = leaf;
+        if (leaf->next != nullptr) {
+            leaf->next->prev = right;
+        } else {
+            lastLeaf = right;
+        }
+        leaf->next = right;
+
+        if (position > half) {
+            position -= half;
+            leaf = right;
+        }
+
+        std::copy_backward(leaf->keys + position, leaf->keys + leaf->count, leaf->keys + leaf->count + 1);
+        std::copy_backward(leaf->values + position, leaf->values + leaf->count, leaf->values + leaf->count + 1);
+        leaf->keys[position] = key;
+        leaf->values[position] = fifoNode;
+        leaf->count++;
+
+        insertIntoParents(path, slots, depth, right->keys[0], right);
+        return true;
+    }
+
+    std::copy_backward(leaf->keys + position, leaf->keys + leaf->count, leaf->keys + leaf->count + 1);
+    std::copy_backward(leaf->values + position, leaf->values + leaf->count, leaf->values + leaf->count + 1);
+    leaf->keys[position] = key;
+    leaf->values[position] = fifoNode;
+    leaf->count++;
+
+    return true;
+}
+
+/**
+*
+* insertIntoParents
+*
+* Method to link a node made by a split next to the node it was split from, splitting
+* inner nodes up the recorded path as they fill, and growing a new root if the old one splits
+*
+* @param    path        inner nodes from the root down to the split node's parent
+* @param    slots       child index taken at each node on path
+* @param    depth       number of nodes on path
+* @param    separator   smallest key under right
+* @param    right       new node holding the upper half
+*
+* @return   nothing
+*/
+void BPlusTree::insertIntoParents(BPlusInnerNode** path, int* slots, int depth, int separator, BPlusNode* right) {
+    while (depth > 0) {
+        depth--;
+        BPlusInnerNode* parent = path[depth];
+        int slot = slots[depth];
+
+        if (parent->count < BPlusInnerNode::CAPACITY) {
+            std::copy_backward(parent->keys + slot, parent->keys + parent->count, parent->keys + parent->count + 1);
+            std::copy_backward(parent->children + slot + 1, parent->children + parent->count + 1, parent->children + parent->count + 2);
+            std::copy_backward(parent->counts + slot + 1, parent->counts + parent->count + 1, parent->counts + parent->count + 2);
+            parent->keys[slot] = separator;
+            parent->children[slot + 1] = right;
+            parent->counts[slot + 1] = subtreeSize(right);
+            parent->counts[slot] -= parent->counts[slot + 1];
+            parent->count++;
+            return;
+        }
+
+        // A full parent: lay out its keys and children with the new pair in place, keep the
+        // lower half, move the upper half to a new node, and push the middle key up
+        int keys[BPlusInnerNode::CAPACITY + 1];
+        BPlusNode* children[BPlusInnerNode::CAPACITY + 2];
+        int counts[BPlusInnerNode::CAPACITY + 2];
+
+        std::copy(parent->keys, parent->keys + slot, keys);
+        keys[slot] = separator;
+        std::copy(parent->keys + slot, parent->keys + parent->count, keys + slot + 1);
+
+        std::copy(parent->children, parent->children + slot + 1, children);
+        children[slot + 1] = right;
+        std::copy(parent->children + slot + 1, parent->children + parent->count + 1, children + slot + 2);
+
+        std::copy(parent->counts, parent->counts + slot + 1, counts);
+        counts[slot + 1] = subtreeSize(right);
+        counts[slot] -= counts[slot + 1];
+        std::copy(parent->counts + slot + 1, parent->counts + parent->count + 1, counts + slot + 2);
+
+        int total = parent->count + 1;
+        int middle = total / 2;
+
+        BPlusInnerNode* sibling = newInner();
+
+        std::copy(keys, keys + middle, parent->keys);
+        std::copy(children, children + middle + 1, parent->children);
+        std::copy(counts, counts + middle + 1, parent->counts);
+        parent->count = middle;
+
+        std::copy(keys + middle + 1, keys + total, sibling->keys);
+        std::copy(children + middle + 1, children + total + 1, sibling->children);
+        std::copy(counts + middle + 1, counts + total + 1, sibling->counts);
+        sibling->count = total - middle - 1;
+
+        separator = keys[middle];
+        right = sibling;
+    }
+
+    // The root split: the tree grows one level
+    BPlusInnerNode* newRoot = newInner();
+    newRoot->keys[0] = separator;
+    newRoot->children[0] = root;
+    newRoot->children[1] = right;
+    newRoot->counts[1] = subtreeSize(right);
+    newRoot->counts[0] = size - newRoot->counts[1];
+    newRoot->count = 1;
+    root = newRoot;
+}
+
+/**
+*
+* remove
+*
+* Method to unlink key
+*
+* @param    key     key to remove
+*
+* @return   true if it was in the tree, false otherwise
+*/
+bool BPlusTree::remove(int key) {
+    if (root == nullptr) {
+        return false;
+    }
+
+    BPlusInnerNode* path[MAX_DEPTH];
+    int slots[MAX_DEPTH];
+    int depth = 0;
+
+    BPlusNode* node = root;
+    while (!node->leaf) {
+        BPlusInnerNode* inner = static_cast<BPlusInnerNode*>(node);
+        int slot = childIndex(inner, key);
+        path[depth] = inner;
+        slots[depth] = slot;
+        depth++;
+        node = inner->children[slot];
+    }
+
+    BPlusLeafNode* leaf = static_cast<BPlusLeafNode*>(node);
+    int position = leafIndex(leaf, key);
+    if (position == leaf->count || leaf->keys[position] != key) {
+        return false;
+    }
+
+    std::copy(leaf->keys + position + 1, leaf->keys + leaf->count, leaf->keys + position);
+    std::copy(leaf->values + position + 1, leaf->values + leaf->count, leaf->values + position);
+    leaf->count--;
+    size--;
+    for (int d = 0; d < depth; d++) {
+        path[d]->counts[slots[d]]--;
+    }
+
+    // Separators above may still hold the removed key; they stay valid bounds, so they are left alone
+    rebalance(path, slots, depth, leaf);
+    return true;
+}
+
+/**
+*
+* rebalance
+*
+* Method to refill a node that a remove left below half full, borrowing from a sibling or
+* merging with one, and repeating one level up when a merge leaves the parent short
+*
+* @param    path    inner nodes from the root down to the node's parent
+* @param    slots   child index taken at each node on path
+* @param    depth   number of nodes on path
+* @param    node    the node that lost a key
+*
+* @return   nothing
+*/
+void BPlusTree::rebalance(BPlusInnerNode** path, int* slots, int depth, BPlusNode* node) {
+    while (depth > 0) {
+        int minimum = node->leaf ? LEAF_MIN_KEYS : INNER_MIN_KEYS;
+        if (node->count >= minimum) {
+            return;
+        }
+
+        depth--;
+        BPlusInnerNode* parent = path[depth];
+        int slot = slots[depth];
+        BPlusNode* left = (slot > 0) ? parent->children[slot - 1] : nullptr;
+        BPlusNode* right = (slot < parent->count) ? parent->children[slot + 1] : nullptr;
+
+        if (node->leaf) {
+            BPlusLeafNode* leaf = static_cast<BPlusLeafNode*>(node);
+            BPlusLeafNode* leftLeaf = static_cast<BPlusLeafNode*>(left);
+            BPlusLeafNode* rightLeaf = static_cast<BPlusLeafNode*>(right);
+
+            if (leftLeaf != nullptr && leftLeaf->count > LEAF_MIN_KEYS) {
+                std::copy_backward(leaf->keys, leaf->keys + leaf->count, leaf->keys + leaf->count + 1);
+                std::copy_backward(leaf->values, leaf->values + leaf->count, leaf->values + leaf->count + 1);
+                leftLeaf->count--;
+                leaf->keys[0] = leftLeaf->keys[leftLeaf->count];
+                leaf->values[0] = leftLeaf->values[leftLeaf->count];
+                leaf->count++;
+                parent->keys[slot - 1] = leaf->keys[0];
+                parent->counts[slot - 1]--;
+                parent->counts[slot]++;
+                return;
+            }
+
+            if (rightLeaf != nullptr && rightLeaf->count > LEAF_MIN_KEYS) {
+                leaf->keys[leaf->count] = rightLeaf->keys[0];
+                leaf->values[leaf->count] = rightLeaf->values[0];
+                leaf->count++;
+                std::copy(rightLeaf->keys + 1, rightLeaf->keys + rightLeaf->count, rightLeaf->keys);
+                std::copy(rightLeaf->values + 1, rightLeaf->values + rightLeaf->count, rightLeaf->values);
+                rightLeaf->count--;
+                parent->keys[slot] = rightLeaf->keys[0];
+                parent->counts[slot]++;
+                parent->counts[slot + 1]--;
+                return;
+            }
+
+            // Merge the right one of the pair into the left one
+            if (leftLeaf == nullptr) {
+                leftLeaf = leaf;
+                slot++;
+            } else {
+                rightLeaf = leaf;
+            }
+
+            std::copy(rightLeaf->keys, rightLeaf->keys + rightLeaf->count, leftLeaf->keys + leftLeaf->count);
+            std::copy(rightLeaf->values, rightLeaf->values + rightLeaf->count, leftLeaf->values + leftLeaf->count);
+            leftLeaf->count += rightLeaf->count;
+
+            leftLeaf->next = rightLeaf->next;
+            if (rightLeaf->next != nullptr) {
+                rightLeaf->next->prev = leftLeaf;
+            } else {
+                lastLeaf = leftLeaf;
+            }
+            freeNode(rightLeaf);
+        } else {
+            BPlusInnerNode* inner = static_cast<BPlusInnerNode*>(node);
+            BPlusInnerNode* leftInner = static_cast<BPlusInnerNode*>(left);
+            BPlusInnerNode* rightInner = static_cast<BPlusInnerNode*>(right);
+
+            // Borrowing rotates through the parent: the separator comes down, the sibling's edge key goes up
+            if (leftInner != nullptr && leftInner->count > INNER_MIN_KEYS) {
+                std::copy_backward(inner->keys, inner->keys + inner->count, inner->keys + inner->count + 1);
+                std::copy_backward(inner->children, inner->children + inner->count + 1, inner->children + inner->count + 2);
+                std::copy_backward(inner->counts, inner->counts + inner->count + 1, inner->counts + inner->count + 2);
+                int moved = leftInner->counts[leftInner->count];
+                inner->keys[0] = parent->keys[slot - 1];
+                inner->children[0] = leftInner->children[leftInner->count];
+                inner->counts[0] = moved;
+                inner->count++;
+                parent->keys[slot - 1] = leftInner->keys[leftInner->count - 1];
+                parent->counts[slot - 1] -= moved;
+                parent->counts[slot] += moved;
+                leftInner->count--;
+                return;
+            }
+
+            if (rightInner != nullptr && rightInner->count > INNER_MIN_KEYS) {
+                int moved = rightInner->counts[0];
+                inner->keys[inner->count] = parent->keys[slot];
+                inner->children[inner->count + 1] = rightInner->children[0];
+                inner->counts[inner->count + 1] = moved;
+                inner->count++;
+                parent->keys[slot] = rightInner->keys[0];
+                parent->counts[slot] += moved;
+                parent->counts[slot + 1] -= moved;
+                std::copy(rightInner->keys + 1, rightInner->keys + rightInner->count, rightInner->keys);
+                std::copy(rightInner->children + 1, rightInner->children + rightInner->count + 1, rightInner->children);
+                std::copy(rightInner->counts + 1, rightInner->counts + rightInner->count + 1, rightInner->counts);
+                rightInner->count--;
+                return;
+            }
+
+            if (leftInner == nullptr) {
+                leftInner = inner;
+                slot++;
+            } else {
+                rightInner = inner;
+            }
+
+            leftInner->keys[leftInner->count] = parent->keys[slot - 1];
+            std::copy(rightInner->keys, rightInner->keys + rightInner->count, leftInner->keys + leftInner->count + 1);
+            std::copy(rightInner->children, rightInner->children + rightInner->count + 1, leftInner->children + leftInner->count + 1);
+            std::copy(rightInner->counts, rightInner->counts + rightInner->count + 1, leftInner->counts + leftInner->count + 1);
+            leftInner->count += 1 + rightInner->count;
+            freeNode(rightInner);
+        }
+
+        // The merged-away node was child slot; its separator is key slot - 1, and its keys now count under slot - 1
+        parent->counts[slot - 1] += parent->counts[slot];
+        std::copy(parent->keys + slot, parent->keys + parent->count, parent->keys + slot - 1);
+        std::copy(parent->children + slot + 1, parent->children + parent->count + 1, parent->children + slot);
+        std::copy(parent->counts + slot + 1, parent->counts + parent->count + 1, parent->counts + slot);
+        parent->count--;
+
+        node = parent;
+    }
+
+    // node is the root: an empty leaf empties the tree, an inner node left with one child hands it the root
+    if (node->count == 0) {
+        if (node->leaf) {
+            root = nullptr;
+            firstLeaf = nullptr;
+            lastLeaf = nullptr;
+        } else {
+            root = static_cast<BPlusInnerNode*>(node)->children[0];
+        }
+        freeNode(node);
+    }
+}
+
+/**
+*
+* getNumberOfItems
+*
+* Method to return the number of keys in the tree
+*
+* @param    none
+*
+* @return   number of keys
+*/
+int BPlusTree::getNumberOfItems() const {
+    return size;
+}
+
+/**
+*
+* isEmpty
+*
+* Method to check if the tree holds no keys
+*
+* @param    none
+*
+* @return   true if empty, false otherwise
+*/
+bool BPlusTree::isEmpty() const {
+    return size == 0;
+}
+
+/**
+*
+* getHeight
+*
+* Method to return the number of levels, counting the leaves
+*
+* @param    none
+*
+* @return   number of levels; 0 for an empty tree
+*/
+int BPlusTree::getHeight() const {
+    int height = 0;
+
+    for (BPlusNode* node = root; node != nullptr; node = node->leaf ? nullptr : static_cast<BPlusInnerNode*>(node)->children[0]) {
+        height++;
+    }
+
+    return height;
+}
+
+/**
+*
+* getMemoryUsage
+*
+* Method to return the bytes held by the tree's nodes
+*
+* @param    none
+*
+* @return   bytes used by inner nodes and leaves
+*/
+size_t BPlusTree::getMemoryUsage() const {
+    return innerNodeCount * sizeof(BPlusInnerNode) + leafNodeCount * sizeof(BPlusLeafNode);
+}
+
+/**
+*
+* attach
+*
+* Method to link an entry under entry->key unless the key is already present
+*
+* @param    entry   entry to link
+*
+* @return   true if the entry was linked, false if its key was already present
+*/
+bool BPlusTree::attach(CacheEntry* entry) {
+    return insert(entry->key, entry);
+}
+
+/**
+*
+* attachSorted
+*
+* Method to build an empty tree from a sorted batch bottom up: full leaves first, then each
+* level of inner nodes over the one below, in linear time
+*
+* @param    entries     entries to link, in strictly ascending key order
+* @param    count       number of entries
+*
+* @return   true if the batch was linked; false, with nothing linked, if the tree is not
+*           empty or the keys are not strictly ascending
+*/
+bool BPlusTree::attachSorted(CacheEntry* const* entries, int count) {
+    if (root != nullptr) {
+        return false;
+    }
+
+    for (int i = 1; i < count; i++) {
+        if (entries[i - 1]->key >= entries[i]->key) {
+            return false;
+        }
+    }
+
+    if (count == 0) {
+        return true;
+    }
+
+    // Each level is split into as few nodes as fit, with the items spread evenly; with two or
+    // more nodes every one is then at least half full, as insert and remove keep them
+    std::vector<BPlusNode*> level;
+    std::vector<int> smallestKeys;
+    std::vector<int> sizes;
+
+    int leaves = (count + BPlusLeafNode::CAPACITY - 1) / BPlusLeafNode::CAPACITY;
+    int next = 0;
+    BPlusLeafNode* previous = nullptr;
+
+    for (int i = 0; i < leaves; i++) {
+        BPlusLeafNode* leaf = newLeaf();
+        leaf->count = count / leaves + ((i < count % leaves) ? 1 : 0);
+        for (int j = 0; j < leaf->count; j++, next++) {
+            leaf->keys[j] = entries[next]->key;
+            leaf->values[j] = entries[next];
+        }
+
+        leaf->prev = previous;
+        if (previous != nullptr) {
+            previous->next = leaf;
+        } else {
+            firstLeaf = leaf;
+        }
+        previous = leaf;
+
+        level.push_back(leaf);
+        smallestKeys.push_back(leaf->keys[0]);
+        sizes.push_back(leaf->count);
+    }
+    lastLeaf = previous;
+
+    while (level.size() > 1) {
+        int children = (int)level.size();
+        int parents = (children + BPlusInnerNode::CAPACITY) / (BPlusInnerNode::CAPACITY + 1);
+        std::vector<BPlusNode*> parentLevel;
+        std::vector<int> parentSmallestKeys;
+        std::vector<int> parentSizes;
+        next = 0;
+
+        for (int i = 0; i < parents; i++) {
+            BPlusInnerNode* inner = newInner();
+            int taken = children / parents + ((i < children % parents) ? 1 : 0);
+            int total = 0;
+
+            // A separator is the smallest key under the child to its right
+            for (int j = 0; j < taken; j++, next++) {
+                inner->children[j] = level[next];
+                inner->counts[j] = sizes[next];
+                if (j > 0) {
+                    inner->keys[j - 1] = smallestKeys[next];
+                }
+                total += sizes[next];
+            }
+            inner->count = taken - 1;
+
+            parentLevel.push_back(inner);
+            parentSmallestKeys.push_back(smallestKeys[next - taken]);
+            parentSizes.push_back(total);
+        }
+
+        level.swap(parentLevel);
+        smallestKeys.swap(parentSmallestKeys);
+        sizes.swap(parentSizes);
+    }
+
+    root = level[0];
+    size = count;
+    return true;
+}
+
+/**
+*
+* detach
+*
+* Method to unlink an entry without deleting it
+*
+* @param    entry   an entry currently linked in this tree
+*
+* @return   nothing
+*/
+void BPlusTree::detach(CacheEntry* entry) {
+    remove(entry->key);
+}
+
+/**
+*
+* detachAll
+*
+* Method to free every node, leaving the entries alone
+*
+* @param    none
+*
+* @return   nothing
+*/
+void BPlusTree::detachAll() {
+    if (root != nullptr) {
+        freeSubtree(root);
+    }
+
+    root = nullptr;
+    firstLeaf = nullptr;
+    lastLeaf = nullptr;
+    size = 0;
+}
+
+/**
+*
+* find
+*
+* Method to look up a key
+*
+* @param    key     key to look up
+*
+* @return   the key's FIFO node, or nullptr if the key is not in the tree
+*/
+DllNode* BPlusTree::find(int key) const {
+    if (root == nullptr) {
+        return nullptr;
+    }
+
+    BPlusLeafNode* leaf = findLeaf(key);
+    int position = leafIndex(leaf, key);
+
+    return (position < leaf->count && leaf->keys[position] == key) ? leaf->values[position] : nullptr;
+}
+
+/**
+*
+* collectRange
+*
+* Method to copy the FIFO nodes of the keys in [low, high] in ascending key order
+*
+* @param    low         the lower bound (inclusive)
+* @param    high        the higher bound (inclusive)
+* @param    results     array of at least maxResults pointers to fill
+* @param    maxResults  most nodes to copy; the scan stops there
+*
+* @return   number of nodes copied
+*/
+int BPlusTree::collectRange(int low, int high, DllNode** results, int maxResults) const {
+    if (root == nullptr || low > high) {
+        return 0;
+    }
+
+    int count = 0;
+    BPlusLeafNode* leaf = findLeaf(low);
+    int position = leafIndex(leaf, low);
+
+    while (leaf != nullptr && count < maxResults) {
+        // Every key left in this leaf is >= low; copy up to high or the result limit
+        int end = (int)(std::upper_bound(leaf->keys + position, leaf->keys + leaf->count, high) - leaf->keys);
+        int take = std::min(end - position, maxResults - count);
+        std::copy(leaf->values + position, leaf->values + position + take, results + count);
+        count += take;
+
+        if (end < leaf->count) {
+            break;
+        }
+
+        leaf = leaf->next;
+        position = 0;
+    }
+
+    return count;
+}
+
+/**
+*
+* countBelow
+*
+* Method to count the keys below key, or at or below it, in one descent
+*
+* @param    key         the bound
+* @param    inclusive   true to count keys <= key, false to count keys < key
+*
+* @return   number of keys counted
+*/
+int BPlusTree::countBelow(int key, bool inclusive) const {
+    if (root == nullptr) {
+        return 0;
+    }
+
+    int count = 0;
+    BPlusNode* node = root;
+
+    // Every key under the children left of the one taken is below key
+    while (!node->leaf) {
+        BPlusInnerNode* inner = static_cast<BPlusInnerNode*>(node);
+        int slot = childIndex(inner, key);
+        for (int i = 0; i < slot; i++) {
+            count += inner->counts[i];
+        }
+        node = inner->children[slot];
+    }
+
+    BPlusLeafNode* leaf = static_cast<BPlusLeafNode*>(node);
+    const int* end = inclusive ? std::upper_bound(leaf->keys, leaf->keys + leaf->count, key) : std::lower_bound(leaf->keys, leaf->keys + leaf->count, key);
+
+    return count + (int)(end - leaf->keys);
+}
+
+/**
+*
+* rank
+*
+* Method to count the keys smaller than key; key itself need not be in the tree
+*
+* @param    key     key to rank
+*
+* @return   number of keys < key, which is key's 0-based position if it is present
+*/
+int BPlusTree::rank(int key) const {
+    return countBelow(key, false);
+}
+
+/**
+*
+* select
+*
+* Method to find the key at a 0-based position in ascending order
+*
+* @param    index   position, 0 for the smallest key
+*
+* @return   that key's FIFO node, or nullptr if index is not in [0, getNumberOfItems())
+*/
+DllNode* BPlusTree::select(int index) const {
+    if (index < 0 || index >= size) {
+        return nullptr;
+    }
+
+    BPlusNode* node = root;
+
+    while (!node->leaf) {
+        BPlusInnerNode* inner = static_cast<BPlusInnerNode*>(node);
+        int slot = 0;
+        while (index >= inner->counts[slot]) {
+            index -= inner->counts[slot];
+            slot++;
+        }
+        node = inner->children[slot];
+    }
+
+    return static_cast<BPlusLeafNode*>(node)->values[index];
+}
+
+/**
+*
+* countInRange
+*
+* Method to count the keys in [low, high]
+*
+* @param    low     the lower bound (inclusive)
+* @param    high    the higher bound (inclusive)
+*
+* @return   number of keys in the range; 0 if low > high
+*/
+int BPlusTree::countInRange(int low, int high) const {
+    if (low > high) {
+        return 0;
+    }
+
+    return countBelow(high, true) - countBelow(low, false);
+}
+
+/**
+*
+* moveCursor
+*
+* function to point a cursor at a slot of a leaf, stepping to the neighbouring leaf when the
+* slot is just past either end, and ending the cursor once the key is outside its bounds
+*
+* @param    cursor      cursor to update
+* @param    leaf        leaf to move to (may be nullptr)
+* @param    position    slot in leaf; leaf->count or -1 moves on to the next or previous leaf
+*
+* @return   nothing
+*/
+static void moveCursor(RangeCursor& cursor, const BPlusLeafNode* leaf, int position) {
+    // Leaves other than an only root are never empty, so one step reaches a key
+    if (leaf != nullptr && position == leaf->count) {
+        leaf = leaf->next;
+        position = 0;
+    } else if (leaf != nullptr && position < 0) {
+        leaf = leaf->prev;
+        position = (leaf != nullptr) ? leaf->count - 1 : 0;
+    }
+
+    if (leaf == nullptr || leaf->count == 0 || leaf->keys[position] < cursor.low || leaf->keys[position] > cursor.high) {
+        cursor.node = nullptr;
+        return;
+    }
+
+    cursor.node = leaf;
+    cursor.position = position;
+    cursor.key = leaf->keys[position];
+    cursor.fifoNode = leaf->values[position];
+}
+
+/**
+*
+* seekRange
+*
+* Method to put a cursor on the first key of its range in its direction, in one descent
+*
+* @param    cursor  cursor whose index, bounds and direction are set
+*
+* @return   nothing; the cursor is invalid if the range holds no key
+*/
+void BPlusTree::seekRange(RangeCursor& cursor) const {
+    if (root == nullptr) {
+        cursor.node = nullptr;
+        return;
+    }
+
+    if (cursor.ascending) {
+        BPlusLeafNode* leaf = findLeaf(cursor.low);
+        moveCursor(cursor, leaf, leafIndex(leaf, cursor.low));
+    } else {
+        // The last key <= high sits just before the first key > high
+        BPlusLeafNode* leaf = findLeaf(cursor.high);
+        int position = (int)(std::upper_bound(leaf->keys, leaf->keys + leaf->count, cursor.high) - leaf->keys);
+        moveCursor(cursor, leaf, position - 1);
+    }
+}
+
+/**
+*
+* stepRange
+*
+* Method to move a valid cursor one slot along its leaf, following the leaf links at either end
+*
+* @param    cursor  cursor to move
+*
+* @return   nothing; the cursor is invalid once it passes its bound
+*/
+void BPlusTree::stepRange(RangeCursor& cursor) const {
+    const BPlusLeafNode* leaf = static_cast<const BPlusLeafNode*>(cursor.node);
+
+    moveCursor(cursor, leaf, cursor.position + (cursor.ascending ? 1 : -1));
+}
+
+/**
+*
+* printLeafKey
+*
+* Method to print one key the way the red-black tree's traversals do, without a color
+*
+* @param    key     key to print
+*
+* @return   nothing
+*/
+void BPlusTree::printLeafKey(int key) const {
+    logToFileAndConsole("Node key: " + std::to_string(key));
+}
+
+/**
+*
+* printRange
+*
+* Method to print every key in [low, high] with its payload, in ascending order
+*
+* @param    low     the lower bound (inclusive)
+* @param    high    the higher bound (inclusive)
+*
+* @return   nothing, but prints out the keys between low and high
+*/
+void BPlusTree::printRange(int low, int high) {
+    logToFileAndConsole("Printing nodes in range [" + std::to_string(low) + ", " + std::to_string(high) + "]");
+
+    if (root == nullptr || low > high) {
+        return;
+    }
+
+    BPlusLeafNode* leaf = findLeaf(low);
+    int position = leafIndex(leaf, low);
+
+    for (; leaf != nullptr; leaf = leaf->next, position = 0) {
+        for (; position < leaf->count; position++) {
+            if (leaf->keys[position] > high) {
+                return;
+            }
+
+            printLeafKey(leaf->keys[position]);
+            if (leaf->values[position] != nullptr) {
+                leaf->values[position]->printNode();
+            }
+        }
+    }
+}
+
+/**
+*
+* printInOrder
+*
+* Method to print every key in ascending order
+*
+* @param    none
+*
+* @return   nothing, but prints out the keys
+*/
+void BPlusTree::printInOrder() const {
+    logToFileAndConsole("Performing In-order traversal");
+
+    for (BPlusLeafNode* leaf = firstLeaf; leaf != nullptr; leaf = leaf->next) {
+        for (int i = 0; i < leaf->count; i++) {
+            printLeafKey(leaf->keys[i]);
+        }
+    }
+}
+
+/**
+*
+* printReverseOrder
+*
+* Method to print every key in descending order
+*
+* @param    none
+*
+* @return   nothing, but prints out the keys
+*/
+void BPlusTree::printReverseOrder() const {
+    logToFileAndConsole("Performing reverse-order traversal");
+
+    for (BPlusLeafNode* leaf = lastLeaf; leaf != nullptr; leaf = leaf->prev) {
+        for (int i = leaf->count - 1; i >= 0; i--) {
+            printLeafKey(leaf->keys[i]);
+        }
+    }
+}
+
+/**
+*
+* printBreadthFirst
+*
+* Method to print the nodes level by level, one line of keys per node
+*
+* @param    none
+*
+* @return   nothing, but prints out the nodes
+*/
+void BPlusTree::printBreadthFirst() const {
+    if (root == nullptr) {
+        logToFileAndConsole("Tree is empty");
+        return;
+    }
+
+    logToFileAndConsole("Performing Breadth First traversal");
+
+    std::queue<BPlusNode*> nodeQueue;
+    nodeQueue.push(root);
+
+    while (!nodeQueue.empty()) {
+        BPlusNode* current = nodeQueue.front();
+        nodeQueue.pop();
+
+        const int* keys = current->leaf ? static_cast<BPlusLeafNode*>(current)->keys : static_cast<BPlusInnerNode*>(current)->keys;
+        std::string line = current->leaf ? "Leaf keys:" : "Inner keys:";
+        for (int i = 0; i < current->count; i++) {
+            line += " " + std::to_string(keys[i]);
+        }
+        logToFileAndConsole(line);
+
+        if (!current->leaf) {
+            BPlusInnerNode* inner = static_cast<BPlusInnerNode*>(current);
+            for (int i = 0; i <= inner->count; i++) {
+                nodeQueue.push(inner->children[i]);
+            }
+        }
+    }
+}
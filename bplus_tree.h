@@ -0,0 +1,455 @@
+/**
+*
+* bplus_tree.h : This is the header file for bplus_tree.cpp.
+*
+* 10/18/26 - Created; B+tree ordered index with cache-line-aligned nodes and linked leaves
+* 10/18/26 - Inner nodes count the keys under each child; added rank, select and countInRange
+* 10/18/26 - Added seekRange and stepRange for RangeCursor
+* 10/18/26 - Added attachSorted, a bottom-up bulk build
+*/
+
+#ifndef _BPLUS_TREE
+#define _BPLUS_TREE
+
+#include "ordered_index.h"
+#include "memory_resources.h"
+
+// Fields shared by inner nodes and leaves; count is the number of keys in the node
+struct BPlusNode {
+	int count;
+	bool leaf;
+};
+
+// Inner node: child i holds the keys k with keys[i - 1] <= k < keys[i], counts[i] of them.
+// 31 keys, 32 children and their counts fill nine cache lines, and a search reads the 124
+// bytes of keys alone.
+struct alignas(64) BPlusInnerNode : BPlusNode {
+	static const int CAPACITY = 31;
+
+	int keys[CAPACITY];
+	BPlusNode* children[CAPACITY + 1];
+	int counts[CAPACITY + 1];		// keys in each child's subtree, for the order statistics
+};
+
+// Leaf: up to 32 sorted keys, their FIFO nodes in a separate array so a search only
+// touches the keys, and links to both neighbours so a scan never climbs back up
+struct alignas(64) BPlusLeafNode : BPlusNode {
+	static const int CAPACITY = 32;
+
+	int keys[CAPACITY];
+	DllNode* values[CAPACITY];
+	BPlusLeafNode* prev;
+	BPlusLeafNode* next;
+};
+
+// Define a class for a B+tree from int keys to FIFO nodes
+//
+// Every key lives in a leaf; inner nodes only hold separator keys. With 32-way nodes a
+// million keys fit in four levels, so a lookup touches four nodes instead of the twenty
+// or so a red-black tree visits, and a range scan reads whole leaves in key order
+// through the leaf links. Nodes are kept at least half full: an insert into a full node
+// splits it, and a remove from a node at the minimum borrows a key from a sibling or
+// merges with it. Unlike SelfBalancingTree the index allocates its own nodes, so an
+// entry's embedded treeLinks go unused. Inner nodes keep the number of keys under each
+// child, so rank and select add up counts on the way down instead of walking the leaves.
+class BPlusTree : public OrderedIndex {
+private:
+	static const int MAX_DEPTH = 16;	// inner levels a descent can record; half-full 32-way nodes reach 2^31 keys in 8
+
+	BPlusNode* root;				// nullptr when empty
+	BPlusLeafNode* firstLeaf;		// leaf with the smallest keys
+	BPlusLeafNode* lastLeaf;		// leaf with the largest keys
+	int size;
+	int innerNodeCount;
+	int leafNodeCount;
+
+	std::pmr::memory_resource* memoryResource;	// source of the nodes; nullptr = new/delete
+
+	/**
+	*
+	* findLeaf
+	*
+	* Method to descend to the leaf whose range covers key
+	*
+	* @param    key     key to look for
+	*
+	* @return   that leaf; the tree must not be empty
+	*/
+	BPlusLeafNode* findLeaf(int key) const;
+
+	/**
+	*
+	* newLeaf
+	*
+	* Method to allocate an empty leaf
+	*
+	* @param    none
+	*
+	* @return   the leaf
+	*/
+	BPlusLeafNode* newLeaf();
+
+	/**
+	*
+	* newInner
+	*
+	* Method to allocate an empty inner node
+	*
+	* @param    none
+	*
+	* @return   the inner node
+	*/
+	BPlusInnerNode* newInner();
+
+	/**
+	*
+	* freeNode
+	*
+	* Method to free one node, inner or leaf
+	*
+	* @param    node    node to free
+	*
+	* @return   nothing
+	*/
+	void freeNode(BPlusNode* node);
+
+	/**
+	*
+	* freeSubtree
+	*
+	* Method to free a node and everything below it
+	*
+	* @param    node    root of the subtree
+	*
+	* @return   nothing
+	*/
+	void freeSubtree(BPlusNode* node);
+
+	/**
+	*
+	* insertIntoParents
+	*
+	* Method to link a node made by a split next to the node it was split from, splitting
+	* inner nodes up the recorded path as they fill, and growing a new root if the old one splits
+	*
+	* @param    path        inner nodes from the root down to the split node's parent
+	* @param    slots       child index taken at each node on path
+	* @param    depth       number of nodes on path
+	* @param    separator   smallest key under right
+	* @param    right       new node holding the upper half
+	*
+	* @return   nothing
+	*/
+	void insertIntoParents(BPlusInnerNode** path, int* slots, int depth, int separator, BPlusNode* right);
+
+	/**
+	*
+	* rebalance
+	*
+	* Method to refill a node that a remove left below half full, borrowing from a sibling or
+	* merging with one, and repeating one level up when a merge leaves the parent short
+	*
+	* @param    path    inner nodes from the root down to the node's parent
+	* @param    slots   child index taken at each node on path
+	* @param    depth   number of nodes on path
+	* @param    node    the node that lost a key
+	*
+	* @return   nothing
+	*/
+	void rebalance(BPlusInnerNode** path, int* slots, int depth, BPlusNode* node);
+
+	/**
+	*
+	* remove
+	*
+	* Method to unlink key
+	*
+	* @param    key     key to remove
+	*
+	* @return   true if it was in the tree, false otherwise
+	*/
+	bool remove(int key);
+
+	/**
+	*
+	* countBelow
+	*
+	* Method to count the keys below key, or at or below it, in one descent
+	*
+	* @param    key         the bound
+	* @param    inclusive   true to count keys <= key, false to count keys < key
+	*
+	* @return   number of keys counted
+	*/
+	int countBelow(int key, bool inclusive) const;
+
+	/**
+	*
+	* printLeafKey
+	*
+	* Method to print one key the way the red-black tree's traversals do, without a color
+	*
+	* @param    key     key to print
+	*
+	* @return   nothing
+	*/
+	void printLeafKey(int key) const;
+
+public:
+	// Constructor makes an empty tree whose nodes come from resource (new/delete if null)
+	BPlusTree(std::pmr::memory_resource* resource = nullptr);
+
+	// Destructor frees every node; the entries are not owned by the tree
+	~BPlusTree();
+
+	/**
+	*
+	* insert
+	*
+	* Method to map key to fifoNode unless key is already present
+	*
+	* @param    key         key to add
+	* @param    fifoNode    FIFO node for key
+	*
+	* @return   true if key was added, false if it was already present (its node is left unchanged)
+	*/
+	bool insert(int key, DllNode* fifoNode);
+
+	/**
+	*
+	* getNumberOfItems
+	*
+	* Method to return the number of keys in the tree
+	*
+	* @param    none
+	*
+	* @return   number of keys
+	*/
+	int getNumberOfItems() const;
+
+	/**
+	*
+	* isEmpty
+	*
+	* Method to check if the tree holds no keys
+	*
+	* @param    none
+	*
+	* @return   true if empty, false otherwise
+	*/
+	bool isEmpty() const;
+
+	/**
+	*
+	* getHeight
+	*
+	* Method to return the number of levels, counting the leaves
+	*
+	* @param    none
+	*
+	* @return   number of levels; 0 for an empty tree
+	*/
+	int getHeight() const;
+
+	/**
+	*
+	* getMemoryUsage
+	*
+	* Method to return the bytes held by the tree's nodes
+	*
+	* @param    none
+	*
+	* @return   bytes used by inner nodes and leaves
+	*/
+	size_t getMemoryUsage() const;
+
+	/**
+	*
+	* attach
+	*
+	* Method to link an entry under entry->key unless the key is already present
+	*
+	* @param    entry   entry to link
+	*
+	* @return   true if the entry was linked, false if its key was already present
+	*/
+	bool attach(CacheEntry* entry);
+
+	/**
+	*
+	* attachSorted
+	*
+	* Method to build an empty tree from a sorted batch bottom up: full leaves first, then each
+	* level of inner nodes over the one below, in linear time
+	*
+	* @param    entries     entries to link, in strictly ascending key order
+	* @param    count       number of entries
+	*
+	* @return   true if the batch was linked; false, with nothing linked, if the tree is not
+	*           empty or the keys are not strictly ascending
+	*/
+	bool attachSorted(CacheEntry* const* entries, int count);
+
+	/**
+	*
+	* detach
+	*
+	* Method to unlink an entry without deleting it
+	*
+	* @param    entry   an entry currently linked in this tree
+	*
+	* @return   nothing
+	*/
+	void detach(CacheEntry* entry);
+
+	/**
+	*
+	* detachAll
+	*
+	* Method to free every node, leaving the entries alone
+	*
+	* @param    none
+	*
+	* @return   nothing
+	*/
+	void detachAll();
+
+	/**
+	*
+	* find
+	*
+	* Method to look up a key
+	*
+	* @param    key     key to look up
+	*
+	* @return   the key's FIFO node, or nullptr if the key is not in the tree
+	*/
+	DllNode* find(int key) const;
+
+	/**
+	*
+	* collectRange
+	*
+	* Method to copy the FIFO nodes of the keys in [low, high] in ascending key order
+	*
+	* @param    low         the lower bound (inclusive)
+	* @param    high        the higher bound (inclusive)
+	* @param    results     array of at least maxResults pointers to fill
+	* @param    maxResults  most nodes to copy; the scan stops there
+	*
+	* @return   number of nodes copied
+	*/
+	int collectRange(int low, int high, DllNode** results, int maxResults) const;
+
+	/**
+	*
+	* rank
+	*
+	* Method to count the keys smaller than key; key itself need not be in the tree
+	*
+	* @param    key     key to rank
+	*
+	* @return   number of keys < key, which is key's 0-based position if it is present
+	*/
+	int rank(int key) const;
+
+	/**
+	*
+	* select
+	*
+	* Method to find the key at a 0-based position in ascending order
+	*
+	* @param    index   position, 0 for the smallest key
+	*
+	* @return   that key's FIFO node, or nullptr if index is not in [0, getNumberOfItems())
+	*/
+	DllNode* select(int index) const;
+
+	/**
+	*
+	* countInRange
+	*
+	* Method to count the keys in [low, high]
+	*
+	* @param    low     the lower bound (inclusive)
+	* @param    high    the higher bound (inclusive)
+	*
+	* @return   number of keys in the range; 0 if low > high
+	*/
+	int countInRange(int low, int high) const;
+
+	/**
+	*
+	* seekRange
+	*
+	* Method to put a cursor on the first key of its range in its direction, in one descent
+	*
+	* @param    cursor  cursor whose index, bounds and direction are set
+	*
+	* @return   nothing; the cursor is invalid if the range holds no key
+	*/
+	void seekRange(RangeCursor& cursor) const;
+
+	/**
+	*
+	* stepRange
+	*
+	* Method to move a valid cursor one slot along its leaf, following the leaf links at either end
+	*
+	* @param    cursor  cursor to move
+	*
+	* @return   nothing; the cursor is invalid once it passes its bound
+	*/
+	void stepRange(RangeCursor& cursor) const;
+
+	/**
+	*
+	* printRange
+	*
+	* Method to print every key in [low, high] with its payload, in ascending order
+	*
+	* @param    low     the lower bound (inclusive)
+	* @param    high    the higher bound (inclusive)
+	*
+	* @return   nothing, but prints out the keys between low and high
+	*/
+	void printRange(int low, int high);
+
+	/**
+	*
+	* printInOrder
+	*
+	* Method to print every key in ascending order
+	*
+	* @param    none
+	*
+	* @return   nothing, but prints out the keys
+	*/
+	void printInOrder() const;
+
+	/**
+	*
+	* printReverseOrder
+	*
+	* Method to print every key in descending order
+	*
+	* @param    none
+	*
+	* @return   nothing, but prints out the keys
+	*/
+	void printReverseOrder() const;
+
+	/**
+	*
+	* printBreadthFirst
+	*
+	* Method to print the nodes level by level, one line of keys per node
+	*
+	* @param    none
+	*
+	* @return   nothing, but prints out the nodes
+	*/
+	void printBreadthFirst() const;
+};
+
+#endif
@@ -0,0 +1,1841 @@
+/**
+*
+* cache_benchmark.cpp : Micro-benchmarks for the cache data structures.
+*
+* Usage: milestone6_benchmark [section] [itemCount]
+*   section     one of: all (default), hash, resize, policy, cache, memory, batch, eviction, weight, ttl, read, evictor,
+*               ordered
+*   itemCount   number of keys per run (default 200000)
+*
+* 10/18/26 - Created; chained HashTable vs open-addressing FlatHashTable lookup throughput and bytes per entry
+* 10/18/26 - Added resize section: per-insert latency while a HashTable grows incrementally from 101 buckets
+* 10/18/26 - Added SwissHashTable to the hash section
+* 10/18/26 - Added policy section: chain-length distribution and throughput of each HashTable hash policy
+* 10/18/26 - Added cache section: CacheManager add/evict and hit cost with heap allocations per add
+* 10/18/26 - cache section measures a full cache and compares preallocated entries; frees are counted too
+* 10/18/26 - Added memory section: batch build/teardown, full-cache churn and tree node churn per memory resource
+* 10/18/26 - Added batch section: getItem loop vs prefetching getItems/containsMany, and add vs addMany
+* 10/18/26 - Added eviction section: hit ratio and throughput of each eviction policy on skewed, uniform, loop and scan traces
+* 10/18/26 - eviction section includes W-TinyLFU
+* 10/18/26 - eviction section includes ARC and a trace that alternates recency and frequency phases
+* 10/18/26 - eviction section includes S3-FIFO
+* 10/18/26 - eviction section includes GDSF, and a zipf trace with per-key costs and payload sizes
+* 10/18/26 - Added weight section: entry-count capacity vs a byte budget on payloads of mixed sizes
+* 10/18/26 - Added ttl section: add and getItem cost with deadlines, and timer wheel expiration cost
+* 10/18/26 - Added read section: getItem vs peek with batched promote, single-threaded and under a reader lock
+* 10/18/26 - read section includes getItemDeferred with per-thread access buffers
+* 10/18/26 - Added evictor section: add latency on a read-through trace with and without the background evictor
+* 10/18/26 - Added ordered section: red-black tree vs B+tree insert, lookup, range scan and remove
+* 10/18/26 - ordered section times rank, select, countInRange and percentile against counting by a range scan
+* 10/18/26 - ordered section times RangeCursor and forEachInRange against collectRange
+* 10/18/26 - ordered section times bulk loads: attachSorted, and addMany of a sorted batch into an empty cache
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <random>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "hash_table.h"
+#include "flat_hash_table.h"
+#include "swiss_hash_table.h"
+#include "cache_manager.h"
+
+std::ofstream _outFile;
+
+// Every heap allocation and free in the process goes through these, so a section can count them
+static long long allocationCount = 0;
+static long long freeCount = 0;
+
+void* operator new(std::size_t size) {
+    allocationCount++;
+    void* memory = std::malloc(size == 0 ? 1 : size);
+    if (memory == nullptr) {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* memory) noexcept {
+    if (memory != nullptr) {
+        freeCount++;
+    }
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+    if (memory != nullptr) {
+        freeCount++;
+    }
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    operator delete(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept {
+    operator delete[](memory);
+}
+
+/**
+*
+* getOutFile
+*
+* function to return the output file; the benchmark never opens it, so table prints are console only
+*
+* @param        none
+*
+* @return       reference to output file
+*/
+std::ofstream& getOutFile() {
+    return _outFile;
+}
+
+/**
+*
+* logToFileAndConsole
+*
+* function to log a message to the console (and the unopened output file)
+*
+* @param message    the message to log
+*
+* @return           nothing
+*/
+void logToFileAndConsole(std::string message) {
+    std::cout << message << std::endl;
+    _outFile << message << std::endl;
+}
+
+typedef std::chrono::steady_clock Clock;
+
+/**
+*
+* nanosecondsPerOperation
+*
+* function to convert an elapsed interval into nanoseconds per operation
+*
+* @param start          start of the interval
+* @param end            end of the interval
+* @param operations     number of operations performed in the interval
+*
+* @return               nanoseconds per operation
+*/
+double nanosecondsPerOperation(Clock::time_point start, Clock::time_point end, int operations) {
+    return std::chrono::duration<double, std::nano>(end - start).count() / operations;
+}
+
+/**
+*
+* makeKeys
+*
+* function to generate count distinct, non-negative keys in random order
+*
+* Key i is (i * odd constant) mod 2^31, which is a bijection, so disjoint index
+* ranges give disjoint key sets.
+*
+* @param count          number of keys
+* @param firstIndex     index of the first key
+* @param seed           random seed for the order
+*
+* @return               the keys
+*/
+std::vector<int> makeKeys(int count, int firstIndex, unsigned int seed) {
+    std::vector<int> keys(count);
+    for (int i = 0; i < count; i++) {
+        keys[i] = (int)(((unsigned int)(firstIndex + i) * 2246822519u) & 0x7fffffffu);
+    }
+
+    std::mt19937 generator(seed);
+    std::shuffle(keys.begin(), keys.end(), generator);
+    return keys;
+}
+
+/**
+*
+* benchmarkHashIndex
+*
+* function to time inserts, hits and misses on one hash engine and print one result row
+*
+* @param name           engine name for the report
+* @param index          empty engine to fill
+* @param keys           keys to insert and look up
+* @param missingKeys    keys that are never inserted
+* @param nodes          FIFO nodes to map the keys to
+*
+* @return               nothing, but prints a row to the console
+*/
+void benchmarkHashIndex(const std::string& name, HashIndex* index, const std::vector<int>& keys, const std::vector<int>& missingKeys, std::vector<DllNode>& nodes) {
+    int count = (int)keys.size();
+    long long checksum = 0;
+
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < count; i++) {
+        index->add(keys[i], &nodes[i]);
+    }
+    Clock::time_point afterInsert = Clock::now();
+
+    for (int i = count - 1; i >= 0; i--) {
+        checksum += (index->getItem(keys[i]) != nullptr) ? 1 : 0;
+    }
+    Clock::time_point afterHits = Clock::now();
+
+    for (int i = 0; i < count; i++) {
+        checksum += index->contains(missingKeys[i]) ? 1 : 0;
+    }
+    Clock::time_point afterMisses = Clock::now();
+
+    double bytesPerEntry = (double)index->getMemoryUsage() / count;
+
+    std::cout << std::left << std::setw(18) << name << std::right << std::fixed << std::setprecision(1)
+        << std::setw(12) << nanosecondsPerOperation(start, afterInsert, count)
+        << std::setw(12) << nanosecondsPerOperation(afterInsert, afterHits, count)
+        << std::setw(12) << nanosecondsPerOperation(afterHits, afterMisses, count)
+        << std::setw(14) << bytesPerEntry
+        << std::setw(12) << index->getSize()
+        << "   (checksum " << checksum << ")" << std::endl;
+}
+
+/**
+*
+* runHashBenchmark
+*
+* function to compare the chained HashTable with the open-addressing FlatHashTable and SwissHashTable
+*
+* @param itemCount      number of keys to insert
+*
+* @return               nothing, but prints a report to the console
+*/
+void runHashBenchmark(int itemCount) {
+    std::cout << "\nHash engines: " << itemCount << " keys, tables sized for " << itemCount << " entries" << std::endl;
+    std::cout << "  ns/insert, ns/hit and ns/miss are per operation; bytes/entry excludes the DllNode payload" << std::endl;
+    std::cout << std::left << std::setw(18) << "engine" << std::right
+        << std::setw(12) << "ns/insert" << std::setw(12) << "ns/hit" << std::setw(12) << "ns/miss"
+        << std::setw(14) << "bytes/entry" << std::setw(12) << "buckets" << std::endl;
+
+    std::vector<int> keys = makeKeys(itemCount, 0, 1);
+    std::vector<int> missingKeys = makeKeys(itemCount, itemCount, 2);
+
+    std::vector<DllNode> nodes;
+    nodes.reserve(itemCount);
+    for (int i = 0; i < itemCount; i++) {
+        nodes.push_back(DllNode(keys[i]));
+    }
+
+    HashTable chained(itemCount);
+    benchmarkHashIndex("chained", &chained, keys, missingKeys, nodes);
+
+    FlatHashTable flat(itemCount);
+    benchmarkHashIndex("openAddressing", &flat, keys, missingKeys, nodes);
+
+    SwissHashTable swiss(itemCount);
+    benchmarkHashIndex("swissTable", &swiss, keys, missingKeys, nodes);
+}
+
+/**
+*
+* runResizeBenchmark
+*
+* function to measure the per-insert latency distribution while a HashTable grows from 101 buckets
+*
+* @param itemCount      number of keys to insert
+*
+* @return               nothing, but prints a report to the console
+*/
+void runResizeBenchmark(int itemCount) {
+    std::cout << "\nIncremental resize: " << itemCount << " inserts into HashTable(101)" << std::endl;
+
+    std::vector<int> keys = makeKeys(itemCount, 0, 3);
+
+    std::vector<DllNode> nodes;
+    nodes.reserve(itemCount);
+    for (int i = 0; i < itemCount; i++) {
+        nodes.push_back(DllNode(keys[i]));
+    }
+
+    std::vector<double> latencies(itemCount);
+    HashTable table(101);
+
+    for (int i = 0; i < itemCount; i++) {
+        Clock::time_point start = Clock::now();
+        table.add(keys[i], &nodes[i]);
+        latencies[i] = nanosecondsPerOperation(start, Clock::now(), 1);
+    }
+
+    int finalBuckets = table.getSize();
+    std::sort(latencies.begin(), latencies.end());
+
+    std::cout << std::fixed << std::setprecision(1)
+        << "  final buckets: " << finalBuckets
+        << ", median: " << latencies[itemCount / 2] << " ns"
+        << ", p99.9: " << latencies[(int)(itemCount * 0.999)] << " ns"
+        << ", p99.99: " << latencies[(int)(itemCount * 0.9999)] << " ns"
+        << ", max: " << latencies[itemCount - 1] << " ns (includes scheduler noise)" << std::endl;
+}
+
+/**
+*
+* benchmarkHashPolicy
+*
+* function to time inserts and hits for one hash policy and print its chain-length distribution
+*
+* @param name           policy name for the report
+* @param keys           keys to insert and look up
+* @param nodes          FIFO nodes to map the keys to
+*
+* @return               nothing, but prints a row to the console
+*/
+template <class HashPolicy>
+void benchmarkHashPolicy(const std::string& name, const std::vector<int>& keys, std::vector<DllNode>& nodes) {
+    int count = (int)keys.size();
+    long long checksum = 0;
+
+    // Sized for count entries, so the load factor never triggers a resize
+    BasicHashTable<HashPolicy> table(count);
+
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < count; i++) {
+        table.add(keys[i], &nodes[i]);
+    }
+    Clock::time_point afterInsert = Clock::now();
+
+    for (int i = count - 1; i >= 0; i--) {
+        checksum += (table.getItem(keys[i]) != nullptr) ? 1 : 0;
+    }
+    Clock::time_point afterHits = Clock::now();
+
+    // Chain lengths 0, 1, 2, 3 and 4+, the longest chain, and the mean nodes visited by a hit
+    int buckets = table.getSize();
+    HashNode** bucketArray = table.getTable();
+    long long lengthCounts[5] = { 0, 0, 0, 0, 0 };
+    long long visitsForAllHits = 0;
+    int longestChain = 0;
+
+    for (int i = 0; i < buckets; i++) {
+        int length = 0;
+        for (HashNode* current = bucketArray[i]; current != nullptr; current = current->next) {
+            length++;
+        }
+
+        lengthCounts[std::min(length, 4)]++;
+        visitsForAllHits += (long long)length * (length + 1) / 2;
+        longestChain = std::max(longestChain, length);
+    }
+
+    std::cout << std::left << std::setw(16) << name << std::right << std::fixed << std::setprecision(1)
+        << std::setw(11) << nanosecondsPerOperation(start, afterInsert, count)
+        << std::setw(9) << nanosecondsPerOperation(afterInsert, afterHits, count)
+        << std::setw(9) << buckets;
+    for (int length = 0; length < 5; length++) {
+        std::cout << std::setw(8) << 100.0 * lengthCounts[length] / buckets;
+    }
+    std::cout << std::setw(8) << longestChain
+        << std::setw(11) << std::setprecision(2) << (double)visitsForAllHits / count
+        << "   (checksum " << checksum << ")" << std::endl;
+}
+
+/**
+*
+* runPolicyBenchmark
+*
+* function to compare the HashTable hash policies on random, sequential and strided keys
+*
+* @param itemCount      number of keys to insert
+*
+* @return               nothing, but prints a report to the console
+*/
+void runPolicyBenchmark(int itemCount) {
+    std::cout << "\nHash policies: " << itemCount << " keys into a chained table sized for " << itemCount << " entries" << std::endl;
+    std::cout << "  len=N columns are the percentage of buckets whose chain has N nodes; visits/hit is the mean chain nodes read by a hit" << std::endl;
+
+    std::vector<std::string> patternNames = { "random", "sequential", "stride 64", "negative" };
+
+    for (size_t pattern = 0; pattern < patternNames.size(); pattern++) {
+        std::vector<int> keys;
+        if (pattern == 0) {
+            keys = makeKeys(itemCount, 0, 4);
+        } else {
+            keys.resize(itemCount);
+            for (int i = 0; i < itemCount; i++) {
+                if (pattern == 1) {
+                    keys[i] = i;
+                } else if (pattern == 2) {
+                    keys[i] = i * 64;
+                } else {
+                    keys[i] = -1 - i;
+                }
+            }
+        }
+
+        std::vector<DllNode> nodes;
+        nodes.reserve(itemCount);
+        for (int i = 0; i < itemCount; i++) {
+            nodes.push_back(DllNode(keys[i]));
+        }
+
+        std::cout << "\n" << patternNames[pattern] << " keys" << std::endl;
+        std::cout << std::left << std::setw(16) << "policy" << std::right
+            << std::setw(11) << "ns/insert" << std::setw(9) << "ns/hit" << std::setw(9) << "buckets"
+            << std::setw(8) << "len=0" << std::setw(8) << "len=1" << std::setw(8) << "len=2"
+            << std::setw(8) << "len=3" << std::setw(8) << "len>=4" << std::setw(8) << "max"
+            << std::setw(11) << "visits/hit" << std::endl;
+
+        benchmarkHashPolicy<ModuloHash>("modulo", keys, nodes);
+        benchmarkHashPolicy<FibonacciHash>("fibonacci", keys, nodes);
+        benchmarkHashPolicy<FastRangeHash>("fastRange", keys, nodes);
+        benchmarkHashPolicy<PowerOfTwoMaskHash>("powerOfTwoMask", keys, nodes);
+    }
+}
+
+/**
+*
+* benchmarkCacheManager
+*
+* function to fill a CacheManager with the first half of keys, then time the second half of the adds
+* (with eviction) and a round of hits, counting heap allocations and frees per add on the full cache
+*
+* @param name           configuration name for the report
+* @param options        engine and entry allocation settings
+* @param capacity       maximum number of cached entries
+* @param keys           keys to add, drawn from a range larger than capacity
+*
+* @return               nothing, but prints a row to the console
+*/
+void benchmarkCacheManager(const std::string& name, const CacheOptions& options, int capacity, const std::vector<int>& keys) {
+    int count = (int)keys.size();
+    int warmupCount = count / 2;
+    long long checksum = 0;
+
+    // Long enough to live outside std::string's inline buffer
+    const std::string fullName = "Firstname Middlename Lastname";
+    const std::string address = "1234 Long Street Name Apt 56";
+
+    CacheManager cacheManager(capacity, capacity, options);
+
+    for (int i = 0; i < warmupCount; i++) {
+        cacheManager.add(keys[i], fullName, address, "Oakland", "CA", "94612");
+    }
+
+    long long allocationsBefore = allocationCount;
+    long long freesBefore = freeCount;
+    Clock::time_point start = Clock::now();
+    for (int i = warmupCount; i < count; i++) {
+        cacheManager.add(keys[i], fullName, address, "Oakland", "CA", "94612");
+    }
+    Clock::time_point afterAdds = Clock::now();
+    long long addAllocations = allocationCount - allocationsBefore;
+    long long addFrees = freeCount - freesBefore;
+    int timedAdds = count - warmupCount;
+
+    for (int i = count - 1; i >= count - capacity; i--) {
+        checksum += (cacheManager.getItem(keys[i]) != nullptr) ? 1 : 0;
+    }
+    Clock::time_point afterHits = Clock::now();
+
+    std::cout << std::left << std::setw(30) << name << std::right << std::fixed << std::setprecision(1)
+        << std::setw(12) << nanosecondsPerOperation(start, afterAdds, timedAdds)
+        << std::setw(14) << std::setprecision(3) << (double)addAllocations / timedAdds
+        << std::setw(12) << (double)addFrees / timedAdds
+        << std::setw(12) << std::setprecision(1) << nanosecondsPerOperation(afterAdds, afterHits, capacity)
+        << "   (checksum " << checksum << ")" << std::endl;
+}
+
+/**
+*
+* runCacheBenchmark
+*
+* function to compare CacheManager add/evict and hit cost across the hash engines
+*
+* @param itemCount      number of adds; the cache holds a quarter of them
+*
+* @return               nothing, but prints a report to the console
+*/
+void runCacheBenchmark(int itemCount) {
+    int capacity = std::max(1, itemCount / 4);
+
+    std::cout << "\nCacheManager: " << itemCount << " adds of keys from a range of " << capacity * 2
+        << " into a cache of " << capacity << " (repeats update in place, misses evict)" << std::endl;
+    std::cout << "  the first half of the adds fill the cache; the columns cover the second half" << std::endl;
+
+    std::vector<int> keys(itemCount);
+    std::mt19937 generator(5);
+    for (int i = 0; i < itemCount; i++) {
+        keys[i] = (int)(generator() % (unsigned int)(capacity * 2));
+    }
+
+    const char* engineNames[] = { "chained", "openAddressing", "swissTable" };
+
+    std::cout << std::left << std::setw(30) << "engine" << std::right
+        << std::setw(12) << "ns/add" << std::setw(14) << "allocs/add" << std::setw(12) << "frees/add"
+        << std::setw(12) << "ns/hit" << std::endl;
+
+    for (int engine = CHAINED; engine <= SWISS_TABLE; engine++) {
+        CacheOptions options;
+        options.hashEngine = (HashEngine)engine;
+        benchmarkCacheManager(engineNames[engine], options, capacity, keys);
+
+        options.preallocateEntries = true;
+        benchmarkCacheManager(std::string(engineNames[engine]) + " preallocated", options, capacity, keys);
+    }
+}
+
+/**
+*
+* benchmarkMemoryResource
+*
+* function to time one memory resource on three workloads and print one result row:
+*   batch   build a cache of every key, then destroy it (a batch job)
+*   churn   add keys from twice the capacity to a full cache, evicting on every miss (a long-running service)
+*   tree    insert every key into a standalone SelfBalancingTree, then remove them all (node allocation only)
+*
+* @param name           resource name for the report
+* @param kind           resource to build with createMemoryResource
+* @param keys           distinct keys
+* @param churnKeys      keys for the churn workload, drawn from twice the churn capacity
+*
+* @return               nothing, but prints a row to the console
+*/
+void benchmarkMemoryResource(const std::string& name, MemoryResourceKind kind, const std::vector<int>& keys, const std::vector<int>& churnKeys) {
+    int count = (int)keys.size();
+    int churnCapacity = std::max(1, count / 4);
+    long long checksum = 0;
+
+    std::pmr::memory_resource* resource = createMemoryResource(kind);
+
+    CacheOptions options;
+    options.memoryResource = resource;
+
+    // Short payload strings stay inside std::string, so only the cache's own allocations are measured
+    Clock::time_point start = Clock::now();
+    {
+        CacheManager cacheManager(count, count, options);
+        for (int i = 0; i < count; i++) {
+            cacheManager.add(keys[i], "name", "addr", "city", "CA", "94612");
+        }
+        checksum += cacheManager.getSize();
+    }
+    Clock::time_point afterBatch = Clock::now();
+
+    Clock::time_point churnStart;
+    {
+        CacheManager cacheManager(churnCapacity, churnCapacity, options);
+        for (int i = 0; i < churnCapacity; i++) {
+            cacheManager.add(churnKeys[i], "name", "addr", "city", "CA", "94612");
+        }
+
+        churnStart = Clock::now();
+        for (int i = churnCapacity; i < count; i++) {
+            cacheManager.add(churnKeys[i], "name", "addr", "city", "CA", "94612");
+        }
+        checksum += cacheManager.getSize();
+    }
+    Clock::time_point afterChurn = Clock::now();
+
+    {
+        SelfBalancingTree tree(resource);
+        bool inserted;
+        for (int i = 0; i < count; i++) {
+            tree.findOrInsert(keys[i], nullptr, inserted);
+        }
+        for (int i = 0; i < count; i++) {
+            checksum += tree.removeNode(keys[i]) ? 1 : 0;
+        }
+    }
+    Clock::time_point afterTree = Clock::now();
+
+    delete resource;
+
+    std::cout << std::left << std::setw(12) << name << std::right << std::fixed << std::setprecision(1)
+        << std::setw(14) << nanosecondsPerOperation(start, afterBatch, count)
+        << std::setw(14) << nanosecondsPerOperation(churnStart, afterChurn, count - churnCapacity)
+        << std::setw(14) << nanosecondsPerOperation(afterChurn, afterTree, count)
+        << "   (checksum " << checksum << ")" << std::endl;
+}
+
+/**
+*
+* runMemoryBenchmark
+*
+* function to compare plain new/delete with the std::pmr resources from createMemoryResource
+*
+* @param itemCount      number of keys per workload
+*
+* @return               nothing, but prints a report to the console
+*/
+void runMemoryBenchmark(int itemCount) {
+    std::cout << "\nMemory resources: " << itemCount << " keys, chained engine" << std::endl;
+    std::cout << "  batch = build + destroy per key; churn = add to a full cache of " << std::max(1, itemCount / 4)
+        << " per add; tree = SelfBalancingTree insert + remove per key" << std::endl;
+    std::cout << std::left << std::setw(12) << "resource" << std::right
+        << std::setw(14) << "ns/batch" << std::setw(14) << "ns/churn" << std::setw(14) << "ns/tree" << std::endl;
+
+    std::vector<int> keys = makeKeys(itemCount, 0, 6);
+
+    int churnCapacity = std::max(1, itemCount / 4);
+    std::vector<int> churnKeys(itemCount);
+    std::mt19937 generator(7);
+    for (int i = 0; i < itemCount; i++) {
+        churnKeys[i] = (int)(generator() % (unsigned int)(churnCapacity * 2));
+    }
+
+    benchmarkMemoryResource("default", DEFAULT_RESOURCE, keys, churnKeys);
+    benchmarkMemoryResource("monotonic", MONOTONIC_RESOURCE, keys, churnKeys);
+    benchmarkMemoryResource("pool", POOL_RESOURCE, keys, churnKeys);
+    benchmarkMemoryResource("hugePage", HUGE_PAGE_RESOURCE, keys, churnKeys);
+
+    std::cout << "  huge pages mapped at exit: " << hugePageResource()->getMappedBytes() << " bytes" << std::endl;
+}
+
+/**
+*
+* benchmarkBatchLookups
+*
+* function to time single-key calls against the batched ones on one engine and print one result row
+*
+* @param name           engine name for the report
+* @param options        engine selection
+* @param keys           keys to cache; the cache holds all of them
+* @param lookups        keys to look up, all cached, in batches of batchSize
+* @param batchSize      keys per batched call
+*
+* @return               nothing, but prints a row to the console
+*/
+void benchmarkBatchLookups(const std::string& name, const CacheOptions& options, const std::vector<int>& keys, const std::vector<int>& lookups, int batchSize) {
+    int count = (int)keys.size();
+    int lookupCount = (int)lookups.size() / batchSize * batchSize;
+    long long checksum = 0;
+
+    std::vector<CacheEntry*> entries(count);
+
+    Clock::time_point start = Clock::now();
+    CacheManager single(count, count, options);
+    for (int i = 0; i < count; i++) {
+        single.add(keys[i], new CacheEntry(keys[i]));
+    }
+    Clock::time_point afterAdd = Clock::now();
+
+    for (int i = 0; i < count; i++) {
+        entries[i] = new CacheEntry(keys[i]);
+    }
+    Clock::time_point beforeAddMany = Clock::now();
+    CacheManager batched(count, count, options);
+    for (int i = 0; i < count; i += batchSize) {
+        batched.addMany(&keys[i], &entries[i], std::min(batchSize, count - i));
+    }
+    Clock::time_point afterAddMany = Clock::now();
+
+    // All lookups go to the same cache so the columns differ only in the calls made
+    for (int i = 0; i < lookupCount; i++) {
+        checksum += (batched.getItem(lookups[i]) != nullptr) ? 1 : 0;
+    }
+    Clock::time_point afterGetItem = Clock::now();
+
+    std::vector<DllNode*> results(batchSize);
+    for (int i = 0; i < lookupCount; i += batchSize) {
+        checksum += batched.getItems(&lookups[i], batchSize, results.data());
+    }
+    Clock::time_point afterGetItems = Clock::now();
+
+    std::unique_ptr<bool[]> flags(new bool[batchSize]);
+    for (int i = 0; i < lookupCount; i += batchSize) {
+        checksum += batched.containsMany(&lookups[i], batchSize, flags.get());
+    }
+    Clock::time_point afterContainsMany = Clock::now();
+
+    std::cout << std::left << std::setw(18) << name << std::right << std::fixed << std::setprecision(1)
+        << std::setw(12) << nanosecondsPerOperation(start, afterAdd, count)
+        << std::setw(12) << nanosecondsPerOperation(beforeAddMany, afterAddMany, count)
+        << std::setw(12) << nanosecondsPerOperation(afterAddMany, afterGetItem, lookupCount)
+        << std::setw(12) << nanosecondsPerOperation(afterGetItem, afterGetItems, lookupCount)
+        << std::setw(14) << nanosecondsPerOperation(afterGetItems, afterContainsMany, lookupCount)
+        << "   (checksum " << checksum << ")" << std::endl;
+}
+
+/**
+*
+* runBatchBenchmark
+*
+* function to compare single-key getItem/add with getItems, containsMany and addMany on every engine
+*
+* @param itemCount      number of cached keys
+*
+* @return               nothing, but prints a report to the console
+*/
+void runBatchBenchmark(int itemCount) {
+    const int batchSize = 32;
+
+    std::cout << "\nBatched calls: " << itemCount << " cached keys, random hits in batches of " << batchSize << std::endl;
+    std::cout << "  all columns are ns per key" << std::endl;
+    std::cout << std::left << std::setw(18) << "engine" << std::right
+        << std::setw(12) << "add" << std::setw(12) << "addMany" << std::setw(12) << "getItem"
+        << std::setw(12) << "getItems" << std::setw(14) << "containsMany" << std::endl;
+
+    std::vector<int> keys = makeKeys(itemCount, 0, 8);
+
+    std::vector<int> lookups(itemCount * 2);
+    std::mt19937 generator(9);
+    for (size_t i = 0; i < lookups.size(); i++) {
+        lookups[i] = keys[generator() % (unsigned int)itemCount];
+    }
+
+    const char* engineNames[] = { "chained", "openAddressing", "swissTable" };
+    for (int engine = CHAINED; engine <= SWISS_TABLE; engine++) {
+        CacheOptions options;
+        options.hashEngine = (HashEngine)engine;
+        benchmarkBatchLookups(engineNames[engine], options, keys, lookups, batchSize);
+    }
+}
+
+/**
+*
+* makeZipfTrace
+*
+* function to draw requestCount keys from keys with Zipf-distributed popularity: the key at
+* rank r (from 1) is requested with probability proportional to 1 / r^exponent
+*
+* @param keys           keys ordered from most to least popular
+* @param requestCount   number of requests
+* @param exponent       skew; larger is more skewed
+* @param seed           random seed
+*
+* @return               the requested keys
+*/
+std::vector<int> makeZipfTrace(const std::vector<int>& keys, int requestCount, double exponent, unsigned int seed) {
+    std::vector<double> cumulative(keys.size());
+    double total = 0.0;
+    for (size_t i = 0; i < keys.size(); i++) {
+        total += 1.0 / std::pow((double)(i + 1), exponent);
+        cumulative[i] = total;
+    }
+
+    std::vector<int> trace(requestCount);
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<double> uniform(0.0, total);
+    for (int i = 0; i < requestCount; i++) {
+        size_t rank = std::lower_bound(cumulative.begin(), cumulative.end(), uniform(generator)) - cumulative.begin();
+        trace[i] = keys[std::min(rank, keys.size() - 1)];
+    }
+
+    return trace;
+}
+
+/**
+*
+* benchmarkEvictionPolicy
+*
+* function to replay a trace against one eviction policy and print one result row; each request
+* is a getItem, and a miss adds the key. A second pass of getItem calls on keys that are still
+* cached times hits on their own, which is where the policies differ in the writes they make.
+*
+* @param name           policy name for the report
+* @param options        eviction policy (entries are preallocated so no request allocates)
+* @param capacity       maximum number of cached entries
+* @param trace          keys to request, in order
+*
+* @return               nothing, but prints a row to the console
+*/
+void benchmarkEvictionPolicy(const std::string& name, const CacheOptions& options, int capacity, const std::vector<int>& trace) {
+    int requestCount = (int)trace.size();
+    int hits = 0;
+    const std::string empty;
+
+    CacheManager cacheManager(capacity, capacity, options);
+
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < requestCount; i++) {
+        if (cacheManager.getItem(trace[i]) != nullptr) {
+            hits++;
+        } else {
+            cacheManager.add(trace[i], empty, empty, empty, empty, empty);
+        }
+    }
+    Clock::time_point afterTrace = Clock::now();
+
+    // Hits only: replay the trace's requests for keys that are cached now
+    std::vector<int> residentRequests;
+    for (int i = 0; i < requestCount && (int)residentRequests.size() < capacity * 4; i++) {
+        if (cacheManager.getTable()->contains(trace[i])) {
+            residentRequests.push_back(trace[i]);
+        }
+    }
+
+    long long checksum = 0;
+    Clock::time_point beforeHits = Clock::now();
+    for (size_t i = 0; i < residentRequests.size(); i++) {
+        checksum += (cacheManager.getItem(residentRequests[i]) != nullptr) ? 1 : 0;
+    }
+    Clock::time_point afterHits = Clock::now();
+
+    std::cout << "  " << std::left << std::setw(16) << name << std::right << std::fixed << std::setprecision(2)
+        << std::setw(12) << 100.0 * hits / requestCount
+        << std::setw(14) << std::setprecision(1) << nanosecondsPerOperation(start, afterTrace, requestCount)
+        << std::setw(12) << nanosecondsPerOperation(beforeHits, afterHits, std::max(1, (int)residentRequests.size()))
+        << "   (checksum " << checksum << ")";
+
+    if (options.evictionPolicy == ARC_EVICTION) {
+        std::cout << "   p = " << cacheManager.getArcTarget();
+    }
+    std::cout << std::endl;
+}
+
+/**
+*
+* benchmarkCostAwareEviction
+*
+* function to replay a trace in which keys differ in reload cost and payload size, and print the
+* share of requests, of reload cost and of requested bytes that were served from the cache
+*
+* @param name           policy name for the report
+* @param options        eviction policy
+* @param capacity       maximum number of cached entries
+* @param trace          keys to request, in order
+*
+* @return               nothing, but prints a row to the console
+*/
+void benchmarkCostAwareEviction(const std::string& name, const CacheOptions& options, int capacity, const std::vector<int>& trace) {
+    const std::string payloads[] = { std::string(8, 'x'), std::string(64, 'x'), std::string(192, 'x'), std::string(512, 'x') };
+    const std::string empty;
+
+    int requestCount = (int)trace.size();
+    int hits = 0;
+    double totalCost = 0.0;
+    double missCost = 0.0;
+    double totalBytes = 0.0;
+    double hitBytes = 0.0;
+
+    CacheManager cacheManager(capacity, capacity, options);
+
+    for (int i = 0; i < requestCount; i++) {
+        // Cost and size are fixed per key, taken from bits of a key hash
+        unsigned int hash = (unsigned int)trace[i] * 2654435761u;
+        double cost = ((hash >> 29) == 0) ? 100.0 : 1.0;
+        const std::string& payload = payloads[(hash >> 8) & 3];
+
+        totalCost += cost;
+        totalBytes += (double)payload.size();
+
+        if (cacheManager.getItem(trace[i]) != nullptr) {
+            hits++;
+            hitBytes += (double)payload.size();
+        } else {
+            missCost += cost;
+            cacheManager.add(trace[i], payload, empty, empty, empty, empty, cost);
+        }
+    }
+
+    std::cout << "  " << std::left << std::setw(16) << name << std::right << std::fixed << std::setprecision(2)
+        << std::setw(12) << 100.0 * hits / requestCount
+        << std::setw(14) << 100.0 * missCost / totalCost
+        << std::setw(12) << 100.0 * hitBytes / totalBytes << std::endl;
+}
+
+/**
+*
+* runEvictionBenchmark
+*
+* function to compare the eviction policies on four traces over itemCount distinct keys, with a
+* cache holding a tenth of them:
+*   zipf        Zipf(0.99) popularity, a typical skewed read workload
+*   uniform     every key equally likely; no policy can beat capacity / keys
+*   loop        keys requested in a fixed cycle slightly larger than the cache
+*   zipf+scan   the zipf trace with a run of never-repeated keys after every capacity requests
+*   shifting    alternating phases: zipf requests (frequency pays), then a stream of new keys that
+*               are each requested again soon after (recency pays)
+*
+* @param itemCount      number of distinct keys; each trace has 5 * itemCount requests
+*
+* @return               nothing, but prints a report to the console
+*/
+void runEvictionBenchmark(int itemCount) {
+    int capacity = std::max(1, itemCount / 10);
+    int requestCount = itemCount * 5;
+
+    std::cout << "\nEviction policies: " << requestCount << " requests over " << itemCount << " keys, cache of " << capacity
+        << " (getItem, add on a miss)" << std::endl;
+
+    std::vector<int> keys = makeKeys(itemCount, 0, 10);
+
+    std::vector<std::string> workloadNames;
+    std::vector<std::vector<int>> traces;
+
+    workloadNames.push_back("zipf");
+    traces.push_back(makeZipfTrace(keys, requestCount, 0.99, 11));
+
+    workloadNames.push_back("uniform");
+    traces.push_back(makeZipfTrace(keys, requestCount, 0.0, 12));
+
+    int loopLength = std::min(itemCount, capacity + capacity / 5 + 1);
+    std::vector<int> loop(requestCount);
+    for (int i = 0; i < requestCount; i++) {
+        loop[i] = keys[i % loopLength];
+    }
+    workloadNames.push_back("loop");
+    traces.push_back(loop);
+
+    // Scan keys come from an index range makeKeys never uses for the popular keys
+    std::vector<int> scanKeys = makeKeys(requestCount, itemCount, 13);
+    std::vector<int> zipfWithScans;
+    int scanPosition = 0;
+    for (int i = 0; i < requestCount; i++) {
+        zipfWithScans.push_back(traces[0][i]);
+        if ((i + 1) % capacity == 0) {
+            for (int j = 0; j < capacity / 2 && scanPosition < requestCount; j++) {
+                zipfWithScans.push_back(scanKeys[scanPosition++]);
+            }
+        }
+    }
+    workloadNames.push_back("zipf+scan");
+    traces.push_back(zipfWithScans);
+
+    // Recency phases draw fresh keys from the scan range; each is re-requested within a
+    // quarter of the cache's worth of requests
+    std::vector<int> shifting(requestCount);
+    int phaseLength = std::max(1, requestCount / 8);
+    int recentCount = std::max(1, capacity / 4);
+    std::mt19937 generator(14);
+    scanPosition = 0;
+    for (int i = 0; i < requestCount; i++) {
+        if ((i / phaseLength) % 2 == 0) {
+            shifting[i] = traces[0][i];
+        } else if (scanPosition < recentCount || generator() % 2 == 0) {
+            shifting[i] = scanKeys[scanPosition++];
+        } else {
+            shifting[i] = scanKeys[scanPosition - 1 - generator() % (unsigned int)recentCount];
+        }
+    }
+    workloadNames.push_back("shifting");
+    traces.push_back(shifting);
+
+    const char* policyNames[] = { "lru", "clock", "tinyLfu", "arc", "s3fifo", "gdsf" };
+
+    for (size_t w = 0; w < traces.size(); w++) {
+        std::cout << workloadNames[w] << std::endl;
+        std::cout << "  " << std::left << std::setw(16) << "policy" << std::right
+            << std::setw(12) << "hit %" << std::setw(14) << "ns/request" << std::setw(12) << "ns/hit" << std::endl;
+
+        for (int policy = LRU_EVICTION; policy <= GDSF_EVICTION; policy++) {
+            CacheOptions options;
+            options.evictionPolicy = (EvictionPolicy)policy;
+            options.preallocateEntries = true;
+            benchmarkEvictionPolicy(policyNames[policy], options, capacity, traces[w]);
+        }
+    }
+
+    std::cout << "zipf, one key in eight costs 100 to reload (the rest 1), payloads of 8 to 512 bytes" << std::endl;
+    std::cout << "  " << std::left << std::setw(16) << "policy" << std::right
+        << std::setw(12) << "hit %" << std::setw(14) << "miss cost %" << std::setw(12) << "byte hit %" << std::endl;
+
+    for (int policy = LRU_EVICTION; policy <= GDSF_EVICTION; policy++) {
+        CacheOptions options;
+        options.evictionPolicy = (EvictionPolicy)policy;
+        options.preallocateEntries = true;
+        benchmarkCostAwareEviction(policyNames[policy], options, capacity, traces[0]);
+    }
+}
+
+/**
+*
+* benchmarkWeightedCapacity
+*
+* function to replay a trace whose keys have payloads of very different sizes and print the hit
+* ratio, the request cost and the largest number of entries and of charged bytes the cache held
+*
+* @param name           mode and policy name for the report
+* @param options        eviction policy and byte budget
+* @param capacity       maximum number of cached entries
+* @param trace          keys to request, in order
+*
+* @return               nothing, but prints a row to the console
+*/
+void benchmarkWeightedCapacity(const std::string& name, const CacheOptions& options, int capacity, const std::vector<int>& trace) {
+    const std::string smallPayload(48, 'x');
+    const std::string largePayload(4000, 'x');
+    const std::string empty;
+
+    int requestCount = (int)trace.size();
+    int hits = 0;
+    int peakEntries = 0;
+    size_t peakBytes = 0;
+
+    CacheManager cacheManager(capacity, capacity, options);
+
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < requestCount; i++) {
+        if (cacheManager.getItem(trace[i]) != nullptr) {
+            hits++;
+            continue;
+        }
+
+        // One key in sixteen has a large payload, fixed per key by bits of a key hash
+        unsigned int hash = (unsigned int)trace[i] * 2654435761u;
+        cacheManager.add(trace[i], ((hash >> 28) == 0) ? largePayload : smallPayload, empty, empty, empty, empty);
+
+        peakEntries = std::max(peakEntries, cacheManager.getSize());
+        peakBytes = std::max(peakBytes, cacheManager.getWeightedSize());
+    }
+    Clock::time_point end = Clock::now();
+
+    std::cout << "  " << std::left << std::setw(16) << name << std::right << std::fixed << std::setprecision(2)
+        << std::setw(12) << 100.0 * hits / requestCount
+        << std::setw(14) << std::setprecision(1) << nanosecondsPerOperation(start, end, requestCount)
+        << std::setw(14) << peakEntries
+        << std::setw(14) << peakBytes / 1024 << std::endl;
+}
+
+/**
+*
+* runWeightedCapacityBenchmark
+*
+* function to compare a cache limited to capacity entries with one limited to the bytes capacity
+* average entries take, on a zipf trace in which one key in sixteen carries a 4000-byte payload;
+* the entry-limited cache's bytes depend on how many large entries it happens to hold
+*
+* @param itemCount      number of distinct keys; the trace has 5 * itemCount requests
+*
+* @return               nothing, but prints a report to the console
+*/
+void runWeightedCapacityBenchmark(int itemCount) {
+    int capacity = std::max(1, itemCount / 10);
+    int requestCount = itemCount * 5;
+
+    std::vector<int> keys = makeKeys(itemCount, 0, 10);
+    std::vector<int> trace = makeZipfTrace(keys, requestCount, 0.99, 11);
+
+    // Charge of an average entry: the fixed overhead plus a sixteenth of a large payload buffer
+    CacheEntry sample(0, std::string(48, 'x'), "", "", "", "");
+    size_t averageBytes = sizeof(CacheEntry) + sizeof(HashNode*) + payloadBytes(&sample) + 4001 / 16;
+    size_t budget = averageBytes * (size_t)capacity;
+
+    std::cout << "\nWeighted capacity: " << requestCount << " requests over " << itemCount << " keys, " << capacity
+        << " entries vs a budget of " << budget / 1024 << " KB (getItem, add on a miss)" << std::endl;
+    std::cout << "  " << std::left << std::setw(16) << "mode" << std::right
+        << std::setw(12) << "hit %" << std::setw(14) << "ns/request" << std::setw(14) << "peak entries" << std::setw(14) << "peak KB" << std::endl;
+
+    const char* policyNames[] = { "lru", "clock", "tinyLfu", "arc", "s3fifo", "gdsf" };
+
+    for (int policy = LRU_EVICTION; policy <= GDSF_EVICTION; policy++) {
+        // Not preallocated: a recycled entry keeps its largest buffer, and is charged for it
+        CacheOptions options;
+        options.evictionPolicy = (EvictionPolicy)policy;
+        benchmarkWeightedCapacity(std::string("entries ") + policyNames[policy], options, capacity, trace);
+
+        // The entry limit only has to stay out of the way of the budget
+        options.maxWeightBytes = budget;
+        benchmarkWeightedCapacity(std::string("bytes ") + policyNames[policy], options, capacity * 2, trace);
+    }
+}
+
+// Hits a reader collects through peek before it takes the write lock to promote them
+static const int PROMOTE_BATCH_SIZE = 64;
+
+// How benchmarkReadPath's readers look keys up and apply their hits
+enum ReadPathMode { EXCLUSIVE_GET_ITEM, PEEK_AND_PROMOTE, DEFERRED_GET_ITEM };
+
+/**
+*
+* benchmarkReadPath
+*
+* function to replay a read-only trace against a full LRU cache from threadCount threads, each
+* taking every threadCount-th request, and print the cost per request. EXCLUSIVE_GET_ITEM does
+* every request as a getItem under an exclusive lock; PEEK_AND_PROMOTE peeks under a shared lock
+* and promotes each PROMOTE_BATCH_SIZE hits under the exclusive lock; DEFERRED_GET_ITEM calls
+* getItemDeferred under a shared lock and, when the cache reports a full access buffer, drains
+* it if the exclusive lock is free.
+*
+* @param name           mode for the report
+* @param keys           keys to cache; the cache holds all of them
+* @param trace          keys to request
+* @param threadCount    number of reader threads
+* @param mode           how readers look keys up
+*
+* @return               nothing, but prints a row to the console
+*/
+void benchmarkReadPath(const std::string& name, const std::vector<int>& keys, const std::vector<int>& trace, int threadCount, ReadPathMode mode) {
+    const std::string empty;
+    int count = (int)keys.size();
+
+    CacheOptions options;
+    options.preallocateEntries = true;
+    CacheManager cacheManager(count, count, options);
+    for (int i = 0; i < count; i++) {
+        cacheManager.add(keys[i], empty, empty, empty, empty, empty);
+    }
+
+    std::shared_mutex cacheLock;
+    std::vector<long long> hits(threadCount, 0);
+
+    auto reader = [&](int thread) {
+        std::vector<int> pending;
+        pending.reserve(PROMOTE_BATCH_SIZE);
+
+        for (size_t i = thread; i < trace.size(); i += threadCount) {
+            if (mode == EXCLUSIVE_GET_ITEM) {
+                std::unique_lock<std::shared_mutex> writeLock(cacheLock);
+                hits[thread] += (cacheManager.getItem(trace[i]) != nullptr) ? 1 : 0;
+                continue;
+            }
+
+            if (mode == DEFERRED_GET_ITEM) {
+                {
+                    std::shared_lock<std::shared_mutex> readLock(cacheLock);
+                    hits[thread] += (cacheManager.getItemDeferred(trace[i]) != nullptr) ? 1 : 0;
+                }
+
+                // A reader never waits to drain: if another thread holds the lock, it drains soon enough
+                if (cacheManager.isDrainDue()) {
+                    std::unique_lock<std::shared_mutex> writeLock(cacheLock, std::try_to_lock);
+                    if (writeLock.owns_lock()) {
+                        cacheManager.drainHits();
+                    }
+                }
+                continue;
+            }
+
+            bool found;
+            {
+                std::shared_lock<std::shared_mutex> readLock(cacheLock);
+                found = cacheManager.containsNoTouch(trace[i]);
+            }
+
+            if (found) {
+                hits[thread]++;
+                pending.push_back(trace[i]);
+            }
+
+            if ((int)pending.size() == PROMOTE_BATCH_SIZE) {
+                std::unique_lock<std::shared_mutex> writeLock(cacheLock);
+                cacheManager.promote(pending.data(), (int)pending.size());
+                pending.clear();
+            }
+        }
+
+        if (!pending.empty()) {
+            std::unique_lock<std::shared_mutex> writeLock(cacheLock);
+            cacheManager.promote(pending.data(), (int)pending.size());
+        }
+    };
+
+    Clock::time_point start = Clock::now();
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threadCount; thread++) {
+        threads.emplace_back(reader, thread);
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    Clock::time_point end = Clock::now();
+
+    long long totalHits = 0;
+    for (long long threadHits : hits) {
+        totalHits += threadHits;
+    }
+
+    std::cout << "  " << std::left << std::setw(24) << name << std::right << std::setw(8) << threadCount
+        << std::fixed << std::setprecision(1) << std::setw(14) << nanosecondsPerOperation(start, end, (int)trace.size())
+        << "   (hits " << totalHits << ")" << std::endl;
+}
+
+/**
+*
+* runReadPathBenchmark
+*
+* function to compare getItem, which relinks the LRU list on every hit and so needs an exclusive
+* lock, with peek, which writes nothing, plus batched promote, and with getItemDeferred, which
+* buffers hits per thread; single-threaded the difference is the cost of the relinks saved by
+* batching, with more threads it is how much reading overlaps
+*
+* @param itemCount      number of cached keys; the trace has 5 * itemCount requests
+*
+* @return               nothing, but prints a report to the console
+*/
+void runReadPathBenchmark(int itemCount) {
+    std::vector<int> keys = makeKeys(itemCount, 0, 30);
+    std::vector<int> trace = makeZipfTrace(keys, itemCount * 5, 0.99, 31);
+
+    std::cout << "\nRead path: " << trace.size() << " zipf requests over " << itemCount << " cached keys (hardware threads: "
+        << std::thread::hardware_concurrency() << ")" << std::endl;
+    std::cout << "  " << std::left << std::setw(24) << "mode" << std::right << std::setw(8) << "threads" << std::setw(14) << "ns/request" << std::endl;
+
+    for (int threadCount = 1; threadCount <= 4; threadCount *= 2) {
+        benchmarkReadPath("getItem, exclusive", keys, trace, threadCount, EXCLUSIVE_GET_ITEM);
+        benchmarkReadPath("peek + promote, shared", keys, trace, threadCount, PEEK_AND_PROMOTE);
+        benchmarkReadPath("getItemDeferred, shared", keys, trace, threadCount, DEFERRED_GET_ITEM);
+    }
+}
+
+// Simulated time for the ttl section, so expirations do not depend on how fast the machine is
+static long long benchmarkTime = 0;
+
+/**
+*
+* getBenchmarkTime
+*
+* function to return the ttl section's simulated time
+*
+* @param    none
+*
+* @return   milliseconds of simulated time
+*/
+long long getBenchmarkTime() {
+    return benchmarkTime;
+}
+
+/**
+*
+* benchmarkTimeToLive
+*
+* function to fill a cache with entries that expire over the next maxTtl milliseconds, time its
+* adds, its getItem hits, and the expiration of every entry as simulated time moves in steps
+*
+* @param name           clock and ttl description for the report
+* @param options        cache options; the clock is set here unless useSteadyClock is true
+* @param keys           keys to add; the cache holds all of them
+* @param maxTtl         ttls are spread from 1 to maxTtl ms; 0 adds entries without one
+* @param useSteadyClock true to read the real clock, false for simulated time
+*
+* @return               nothing, but prints a row to the console
+*/
+void benchmarkTimeToLive(const std::string& name, CacheOptions options, const std::vector<int>& keys, long long maxTtl, bool useSteadyClock) {
+    int count = (int)keys.size();
+    const std::string empty;
+
+    benchmarkTime = 0;
+    if (!useSteadyClock) {
+        options.clock = getBenchmarkTime;
+    }
+
+    CacheManager cacheManager(count, count, options);
+    std::mt19937 generator(21);
+
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < count; i++) {
+        long long ttl = (maxTtl > 0) ? 1 + (long long)(generator() % (unsigned long long)maxTtl) : 0;
+        cacheManager.add(keys[i], empty, empty, empty, empty, empty, std::chrono::milliseconds(ttl));
+    }
+    Clock::time_point afterAdd = Clock::now();
+
+    long long checksum = 0;
+    for (int i = 0; i < count; i++) {
+        checksum += (cacheManager.getItem(keys[i]) != nullptr) ? 1 : 0;
+    }
+    Clock::time_point afterGet = Clock::now();
+
+    // Step through the ttl range a hundred times, so each call expires about 1% of the cache
+    int expired = 0;
+    long long step = std::max(1LL, maxTtl / 100);
+    for (long long elapsed = 0; !useSteadyClock && maxTtl > 0 && elapsed <= maxTtl; elapsed += step) {
+        benchmarkTime += step;
+        expired += cacheManager.expireEntries();
+    }
+    Clock::time_point afterExpire = Clock::now();
+
+    std::cout << "  " << std::left << std::setw(24) << name << std::right << std::fixed << std::setprecision(1)
+        << std::setw(12) << nanosecondsPerOperation(start, afterAdd, count)
+        << std::setw(12) << nanosecondsPerOperation(afterAdd, afterGet, count);
+    if (expired > 0) {
+        std::cout << std::setw(14) << nanosecondsPerOperation(afterGet, afterExpire, expired);
+    } else {
+        std::cout << std::setw(14) << "-";
+    }
+    std::cout << std::setw(10) << expired << "   (checksum " << checksum << ")" << std::endl;
+}
+
+/**
+*
+* runTimeToLiveBenchmark
+*
+* function to compare adds and hits without deadlines, with deadlines on simulated time, and
+* with deadlines on the steady clock (whose reads getItem pays for), and the cost of expiring
+* entries through the timer wheel with ttls from a second to a month
+*
+* @param itemCount      number of keys
+*
+* @return               nothing, but prints a report to the console
+*/
+void runTimeToLiveBenchmark(int itemCount) {
+    std::vector<int> keys = makeKeys(itemCount, 0, 20);
+
+    std::cout << "\nTime to live: " << itemCount << " entries (ns per add, per getItem hit, per expired entry)" << std::endl;
+    std::cout << "  " << std::left << std::setw(24) << "ttls" << std::right
+        << std::setw(12) << "ns/add" << std::setw(12) << "ns/get" << std::setw(14) << "ns/expire" << std::setw(10) << "expired" << std::endl;
+
+    CacheOptions options;
+    options.preallocateEntries = true;
+
+    benchmarkTimeToLive("none", options, keys, 0, false);
+    benchmarkTimeToLive("1 s, simulated", options, keys, 1000, false);
+    benchmarkTimeToLive("1 min, simulated", options, keys, 60 * 1000LL, false);
+    benchmarkTimeToLive("1 day, simulated", options, keys, 24 * 3600 * 1000LL, false);
+    benchmarkTimeToLive("30 days, simulated", options, keys, 30 * 24 * 3600 * 1000LL, false);
+    benchmarkTimeToLive("1 min, steady clock", options, keys, 60 * 1000LL, true);
+}
+
+/**
+*
+* benchmarkBackgroundEviction
+*
+* function to replay a read-through trace: every request is a getItem under the cache lock, and
+* a miss adds the key. Prints the hit ratio, the cost per request and the latency distribution
+* of the adds, which is where synchronous eviction shows up.
+*
+* @param name           configuration for the report
+* @param options        cache settings; evictionLock is set to the benchmark's lock when background is true
+* @param capacity       entry limit
+* @param trace          keys to request
+* @param background     true to start the background evictor
+*
+* @return               nothing, but prints a row to the console
+*/
+void benchmarkBackgroundEviction(const std::string& name, CacheOptions options, int capacity, const std::vector<int>& trace, bool background) {
+    const std::string empty;
+    std::shared_mutex cacheLock;
+    if (background) {
+        options.evictionLock = &cacheLock;
+    }
+
+    std::vector<double> latencies;
+    latencies.reserve(trace.size());
+    long long hits = 0;
+
+    Clock::time_point start = Clock::now();
+    {
+        CacheManager cacheManager(capacity, capacity, options);
+
+        for (int key : trace) {
+            std::unique_lock<std::shared_mutex> writeLock(cacheLock);
+            if (cacheManager.getItem(key) != nullptr) {
+                hits++;
+                continue;
+            }
+
+            Clock::time_point addStart = Clock::now();
+            cacheManager.add(key, empty, empty, empty, empty, empty);
+            latencies.push_back(nanosecondsPerOperation(addStart, Clock::now(), 1));
+        }
+    }
+    Clock::time_point end = Clock::now();
+
+    std::sort(latencies.begin(), latencies.end());
+    size_t adds = latencies.size();
+    double total = 0.0;
+    for (double latency : latencies) {
+        total += latency;
+    }
+
+    std::cout << "  " << std::left << std::setw(24) << name << std::right << std::fixed << std::setprecision(1)
+        << std::setw(9) << 100.0 * hits / trace.size() << "%"
+        << std::setw(12) << nanosecondsPerOperation(start, end, (int)trace.size())
+        << std::setw(10) << total / adds
+        << std::setw(10) << latencies[adds / 2]
+        << std::setw(10) << latencies[(size_t)(adds * 0.99)]
+        << std::setw(10) << latencies[(size_t)(adds * 0.999)] << std::endl;
+}
+
+/**
+*
+* runBackgroundEvictionBenchmark
+*
+* function to compare add evicting one victim per miss with the background evictor keeping the
+* cache between its watermarks, for LRU and S3-FIFO on a zipf read-through trace
+*
+* @param itemCount      cache capacity; the trace has 10 * itemCount requests over 4 * itemCount keys
+*
+* @return               nothing, but prints a report to the console
+*/
+void runBackgroundEvictionBenchmark(int itemCount) {
+    std::vector<int> keys = makeKeys(itemCount * 4, 0, 40);
+    std::vector<int> trace = makeZipfTrace(keys, itemCount * 10, 0.99, 41);
+
+    std::cout << "\nBackground eviction: " << trace.size() << " zipf read-through requests, capacity " << itemCount
+        << " (hardware threads: " << std::thread::hardware_concurrency() << ")" << std::endl;
+    std::cout << "  " << std::left << std::setw(24) << "configuration" << std::right << std::setw(10) << "hit ratio"
+        << std::setw(12) << "ns/request" << std::setw(10) << "add mean" << std::setw(10) << "median"
+        << std::setw(10) << "p99" << std::setw(10) << "p99.9" << std::endl;
+
+    const EvictionPolicy policies[] = { LRU_EVICTION, S3_FIFO_EVICTION };
+    const char* policyNames[] = { "lru", "s3fifo" };
+
+    for (int i = 0; i < 2; i++) {
+        CacheOptions options;
+        options.evictionPolicy = policies[i];
+        options.preallocateEntries = true;
+
+        benchmarkBackgroundEviction(std::string(policyNames[i]) + ", add evicts", options, itemCount, trace, false);
+        benchmarkBackgroundEviction(std::string(policyNames[i]) + ", background", options, itemCount, trace, true);
+    }
+}
+
+/**
+*
+* benchmarkOrderedIndex
+*
+* function to time one ordered index engine: attaching every entry in random and in ascending
+* key order, finding every key, scanning ranges of two widths, and detaching every entry
+*
+* @param name           engine name for the report
+* @param engine         engine to build
+* @param entries        entries to index, one per key
+* @param order          a random permutation of entry positions
+* @param rangeStarts    first key of each scanned range
+* @param keyGap         distance between consecutive keys, so a range of w keys spans w * keyGap
+*
+* @return               nothing, but prints a row to the console
+*/
+void benchmarkOrderedIndex(const std::string& name, OrderedIndexEngine engine, std::vector<CacheEntry>& entries, const std::vector<int>& order, const std::vector<int>& rangeStarts, int keyGap) {
+    int count = (int)entries.size();
+    const int widths[] = { 100, 10000 };
+    std::vector<DllNode*> results(widths[1]);
+    long long checksum = 0;
+
+    auto makeIndex = [&]() -> OrderedIndex* {
+        if (engine == B_PLUS_TREE) {
+            return new BPlusTree();
+        }
+        return new SelfBalancingTree();
+    };
+
+    OrderedIndex* sequential = makeIndex();
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < count; i++) {
+        sequential->attach(&entries[i]);
+    }
+    Clock::time_point afterSequential = Clock::now();
+    sequential->detachAll();
+    delete sequential;
+
+    OrderedIndex* index = makeIndex();
+    Clock::time_point randomStart = Clock::now();
+    for (int i = 0; i < count; i++) {
+        index->attach(&entries[order[i]]);
+    }
+    Clock::time_point afterRandom = Clock::now();
+
+    for (int i = 0; i < count; i++) {
+        checksum += (index->find(entries[order[i]].key) != nullptr) ? 1 : 0;
+    }
+    Clock::time_point afterFind = Clock::now();
+
+    double scanNanoseconds[2];
+    for (int w = 0; w < 2; w++) {
+        long long scanned = 0;
+        int scans = (int)rangeStarts.size() / ((w == 0) ? 1 : 20);
+        Clock::time_point scanStart = Clock::now();
+        for (int i = 0; i < scans; i++) {
+            int found = index->collectRange(rangeStarts[i], rangeStarts[i] + (widths[w] - 1) * keyGap, results.data(), widths[w]);
+            for (int j = 0; j < found; j++) {
+                checksum += results[j]->key;
+            }
+            scanned += found;
+        }
+        scanNanoseconds[w] = nanosecondsPerOperation(scanStart, Clock::now(), (int)std::max(1LL, scanned));
+    }
+
+    Clock::time_point removeStart = Clock::now();
+    for (int i = 0; i < count; i++) {
+        index->detach(&entries[order[count - 1 - i]]);
+    }
+    Clock::time_point afterRemove = Clock::now();
+    delete index;
+
+    std::cout << "  " << std::left << std::setw(14) << name << std::right << std::fixed << std::setprecision(1)
+        << std::setw(12) << nanosecondsPerOperation(randomStart, afterRandom, count)
+        << std::setw(12) << nanosecondsPerOperation(start, afterSequential, count)
+        << std::setw(10) << nanosecondsPerOperation(afterRandom, afterFind, count)
+        << std::setw(12) << scanNanoseconds[0]
+        << std::setw(12) << scanNanoseconds[1]
+        << std::setw(10) << nanosecondsPerOperation(removeStart, afterRemove, count)
+        << "   (checksum " << checksum << ")" << std::endl;
+}
+
+/**
+*
+* benchmarkOrderStatistics
+*
+* function to time one ordered index engine's order statistics on a full index, and to count
+* the same ranges the way a caller would without them, by collecting every key in the range
+*
+* @param name           engine name for the report
+* @param engine         engine to build
+* @param entries        entries to index, one per key
+* @param order          a random permutation of entry positions
+* @param rangeStarts    first key of each counted range
+* @param keyGap         distance between consecutive keys, so a range of w keys spans w * keyGap
+*
+* @return               nothing, but prints a row to the console
+*/
+void benchmarkOrderStatistics(const std::string& name, OrderedIndexEngine engine, std::vector<CacheEntry>& entries, const std::vector<int>& order, const std::vector<int>& rangeStarts, int keyGap) {
+    int count = (int)entries.size();
+    const int width = 10000;
+    std::vector<DllNode*> results(width);
+    long long checksum = 0;
+
+    OrderedIndex* index = (engine == B_PLUS_TREE) ? (OrderedIndex*)new BPlusTree() : (OrderedIndex*)new SelfBalancingTree();
+    for (int i = 0; i < count; i++) {
+        index->attach(&entries[order[i]]);
+    }
+
+    // Each query runs once per shuffled key, so every run walks a different path
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < count; i++) {
+        checksum += index->rank(entries[order[i]].key);
+    }
+    Clock::time_point afterRank = Clock::now();
+
+    for (int i = 0; i < count; i++) {
+        checksum += index->select(order[i])->key;
+    }
+    Clock::time_point afterSelect = Clock::now();
+
+    for (int i = 0; i < count; i++) {
+        checksum += index->percentile(100.0 * order[i] / count)->key;
+    }
+    Clock::time_point afterPercentile = Clock::now();
+
+    int ranges = (int)rangeStarts.size();
+    for (int i = 0; i < ranges; i++) {
+        checksum += index->countInRange(rangeStarts[i], rangeStarts[i] + (width - 1) * keyGap);
+    }
+    Clock::time_point afterCount = Clock::now();
+
+    for (int i = 0; i < ranges; i++) {
+        checksum += index->collectRange(rangeStarts[i], rangeStarts[i] + (width - 1) * keyGap, results.data(), width);
+    }
+    Clock::time_point afterScan = Clock::now();
+
+    index->detachAll();
+    delete index;
+
+    std::cout << "  " << std::left << std::setw(14) << name << std::right << std::fixed << std::setprecision(1)
+        << std::setw(10) << nanosecondsPerOperation(start, afterRank, count)
+        << std::setw(10) << nanosecondsPerOperation(afterRank, afterSelect, count)
+        << std::setw(12) << nanosecondsPerOperation(afterSelect, afterPercentile, count)
+        << std::setw(14) << nanosecondsPerOperation(afterPercentile, afterCount, ranges)
+        << std::setw(14) << nanosecondsPerOperation(afterCount, afterScan, ranges)
+        << "   (checksum " << checksum << ")" << std::endl;
+}
+
+/**
+*
+* benchmarkRangeCursor
+*
+* function to time reading ranges of one ordered index engine three ways: copying them out with
+* collectRange, stepping a RangeCursor in each direction, and calling forEachInRange
+*
+* @param name           engine name for the report
+* @param engine         engine to build
+* @param entries        entries to index, one per key
+* @param order          a random permutation of entry positions
+* @param rangeStarts    first key of each range
+* @param keyGap         distance between consecutive keys, so a range of w keys spans w * keyGap
+*
+* @return               nothing, but prints a row to the console
+*/
+void benchmarkRangeCursor(const std::string& name, OrderedIndexEngine engine, std::vector<CacheEntry>& entries, const std::vector<int>& order, const std::vector<int>& rangeStarts, int keyGap) {
+    int count = (int)entries.size();
+    const int width = 1000;
+    std::vector<DllNode*> results(width);
+    long long checksum = 0;
+    long long visited = 0;
+
+    OrderedIndex* index = (engine == B_PLUS_TREE) ? (OrderedIndex*)new BPlusTree() : (OrderedIndex*)new SelfBalancingTree();
+    for (int i = 0; i < count; i++) {
+        index->attach(&entries[order[i]]);
+    }
+
+    int ranges = (int)rangeStarts.size();
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < ranges; i++) {
+        int found = index->collectRange(rangeStarts[i], rangeStarts[i] + (width - 1) * keyGap, results.data(), width);
+        for (int j = 0; j < found; j++) {
+            checksum += results[j]->key;
+        }
+        visited += found;
+    }
+    Clock::time_point afterCollect = Clock::now();
+
+    for (int i = 0; i < ranges; i++) {
+        for (RangeCursor cursor = index->openRange(rangeStarts[i], rangeStarts[i] + (width - 1) * keyGap); cursor.isValid(); cursor.next()) {
+            checksum += cursor.fifoNode->key;
+        }
+    }
+    Clock::time_point afterAscending = Clock::now();
+
+    for (int i = 0; i < ranges; i++) {
+        for (RangeCursor cursor = index->openRange(rangeStarts[i], rangeStarts[i] + (width - 1) * keyGap, false); cursor.isValid(); cursor.next()) {
+            checksum += cursor.fifoNode->key;
+        }
+    }
+    Clock::time_point afterDescending = Clock::now();
+
+    for (int i = 0; i < ranges; i++) {
+        index->forEachInRange(rangeStarts[i], rangeStarts[i] + (width - 1) * keyGap, [&checksum](int, DllNode* fifoNode) {
+            checksum += fifoNode->key;
+        });
+    }
+    Clock::time_point afterForEach = Clock::now();
+
+    index->detachAll();
+    delete index;
+
+    int perKey = (int)std::max(1LL, visited);
+    std::cout << "  " << std::left << std::setw(14) << name << std::right << std::fixed << std::setprecision(1)
+        << std::setw(14) << nanosecondsPerOperation(start, afterCollect, perKey)
+        << std::setw(12) << nanosecondsPerOperation(afterCollect, afterAscending, perKey)
+        << std::setw(12) << nanosecondsPerOperation(afterAscending, afterDescending, perKey)
+        << std::setw(16) << nanosecondsPerOperation(afterDescending, afterForEach, perKey)
+        << "   (checksum " << checksum << ")" << std::endl;
+}
+
+/**
+*
+* benchmarkBulkLoad
+*
+* function to time loading sorted keys into one ordered index engine, key by key and with
+* attachSorted, and filling an empty CacheManager with an add loop and with one sorted addMany
+*
+* @param name           engine name for the report
+* @param engine         engine to build
+* @param entries        entries to index, in ascending key order
+*
+* @return               nothing, but prints a row to the console
+*/
+void benchmarkBulkLoad(const std::string& name, OrderedIndexEngine engine, std::vector<CacheEntry>& entries) {
+    int count = (int)entries.size();
+    long long checksum = 0;
+
+    std::vector<CacheEntry*> sorted(count);
+    for (int i = 0; i < count; i++) {
+        sorted[i] = &entries[i];
+    }
+
+    OrderedIndex* index = (engine == B_PLUS_TREE) ? (OrderedIndex*)new BPlusTree() : (OrderedIndex*)new SelfBalancingTree();
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < count; i++) {
+        index->attach(sorted[i]);
+    }
+    Clock::time_point afterAttach = Clock::now();
+    checksum += index->getNumberOfItems();
+    index->detachAll();
+
+    Clock::time_point beforeBulk = Clock::now();
+    index->attachSorted(sorted.data(), count);
+    Clock::time_point afterBulk = Clock::now();
+    checksum += index->getNumberOfItems();
+    index->detachAll();
+    delete index;
+
+    // The cache owns its entries, so each run gets its own, allocated outside the timed part
+    CacheOptions options;
+    options.orderedIndex = engine;
+    std::vector<int> keys(count);
+    std::vector<CacheEntry*> owned(count);
+    for (int i = 0; i < count; i++) {
+        keys[i] = entries[i].key;
+        owned[i] = new CacheEntry(keys[i]);
+    }
+
+    CacheManager* looped = new CacheManager(count, count, options);
+    Clock::time_point beforeLoop = Clock::now();
+    for (int i = 0; i < count; i++) {
+        looped->add(keys[i], owned[i]);
+    }
+    Clock::time_point afterLoop = Clock::now();
+    checksum += looped->getSize();
+    delete looped;
+
+    for (int i = 0; i < count; i++) {
+        owned[i] = new CacheEntry(keys[i]);
+    }
+
+    CacheManager* batched = new CacheManager(count, count, options);
+    Clock::time_point beforeAddMany = Clock::now();
+    batched->addMany(keys.data(), owned.data(), count);
+    Clock::time_point afterAddMany = Clock::now();
+    checksum += batched->getSize();
+    delete batched;
+
+    std::cout << "  " << std::left << std::setw(14) << name << std::right << std::fixed << std::setprecision(1)
+        << std::setw(12) << nanosecondsPerOperation(start, afterAttach, count)
+        << std::setw(14) << nanosecondsPerOperation(beforeBulk, afterBulk, count)
+        << std::setw(12) << nanosecondsPerOperation(beforeLoop, afterLoop, count)
+        << std::setw(16) << nanosecondsPerOperation(beforeAddMany, afterAddMany, count)
+        << "   (checksum " << checksum << ")" << std::endl;
+}
+
+/**
+*
+* runOrderedIndexBenchmark
+*
+* function to compare the red-black tree, one TreeNode per key linked by pointers, with the
+* B+tree, whose leaves hold 32 keys side by side; the range columns are ns per key returned
+*
+* @param itemCount      number of keys
+*
+* @return               nothing, but prints a report to the console
+*/
+void runOrderedIndexBenchmark(int itemCount) {
+    const int keyGap = 3;
+
+    // Entries are created in key order but attached in a shuffled order, as a cache fills
+    std::vector<CacheEntry> entries;
+    entries.reserve(itemCount);
+    for (int i = 0; i < itemCount; i++) {
+        entries.emplace_back(i * keyGap);
+    }
+
+    std::vector<int> order(itemCount);
+    for (int i = 0; i < itemCount; i++) {
+        order[i] = i;
+    }
+    std::mt19937 random(50);
+    std::shuffle(order.begin(), order.end(), random);
+
+    std::vector<int> rangeStarts(2000);
+    std::uniform_int_distribution<int> startKey(0, itemCount * keyGap);
+    for (int& rangeStart : rangeStarts) {
+        rangeStart = startKey(random);
+    }
+
+    std::cout << "\nOrdered index: " << itemCount << " keys; ns per insert, find and remove, ns per key returned by a range scan" << std::endl;
+    std::cout << "  " << std::left << std::setw(14) << "engine" << std::right << std::setw(12) << "insert rnd"
+        << std::setw(12) << "insert seq" << std::setw(10) << "find" << std::setw(12) << "range 100"
+        << std::setw(12) << "range 10k" << std::setw(10) << "remove" << std::endl;
+
+    benchmarkOrderedIndex("redBlackTree", RED_BLACK_TREE, entries, order, rangeStarts, keyGap);
+    benchmarkOrderedIndex("bPlusTree", B_PLUS_TREE, entries, order, rangeStarts, keyGap);
+
+    BPlusTree sizing;
+    for (int i = 0; i < itemCount; i++) {
+        sizing.attach(&entries[order[i]]);
+    }
+    std::cout << "  index bytes per key: redBlackTree " << sizeof(TreeNode) << " (embedded in each entry), bPlusTree "
+        << std::fixed << std::setprecision(1) << (double)sizing.getMemoryUsage() / itemCount
+        << " (height " << sizing.getHeight() << ")" << std::endl;
+
+    std::cout << "\nOrder statistics: ns per query on " << itemCount << " keys; the count columns cover ranges of 10000 keys" << std::endl;
+    std::cout << "  " << std::left << std::setw(14) << "engine" << std::right << std::setw(10) << "rank"
+        << std::setw(10) << "select" << std::setw(12) << "percentile" << std::setw(14) << "countInRange"
+        << std::setw(14) << "count by scan" << std::endl;
+
+    benchmarkOrderStatistics("redBlackTree", RED_BLACK_TREE, entries, order, rangeStarts, keyGap);
+    benchmarkOrderStatistics("bPlusTree", B_PLUS_TREE, entries, order, rangeStarts, keyGap);
+
+    std::cout << "\nRange reads: ns per key over ranges of 1000 keys" << std::endl;
+    std::cout << "  " << std::left << std::setw(14) << "engine" << std::right << std::setw(14) << "collectRange"
+        << std::setw(12) << "cursor asc" << std::setw(12) << "cursor desc" << std::setw(16) << "forEachInRange" << std::endl;
+
+    benchmarkRangeCursor("redBlackTree", RED_BLACK_TREE, entries, order, rangeStarts, keyGap);
+    benchmarkRangeCursor("bPlusTree", B_PLUS_TREE, entries, order, rangeStarts, keyGap);
+
+    std::cout << "\nBulk load: ns per key loading " << itemCount << " sorted keys into an empty index or cache" << std::endl;
+    std::cout << "  " << std::left << std::setw(14) << "engine" << std::right << std::setw(12) << "attach seq"
+        << std::setw(14) << "attachSorted" << std::setw(12) << "add loop" << std::setw(16) << "addMany sorted" << std::endl;
+
+    benchmarkBulkLoad("redBlackTree", RED_BLACK_TREE, entries);
+    benchmarkBulkLoad("bPlusTree", B_PLUS_TREE, entries);
+}
+
+/**
+*
+* main
+*
+* main function which runs the requested benchmark sections
+*
+* @param    argc    argument count
+* @param    argv    optional section name and item count
+*
+* @return   0 on success, 1 on bad arguments
+*/
+int main(int argc, char* argv[]) {
+    std::string section = (argc > 1) ? argv[1] : "all";
+    int itemCount = (argc > 2) ? std::stoi(argv[2]) : 200000;
+
+    if (itemCount <= 0) {
+        std::cerr << "itemCount must be positive" << std::endl;
+        return 1;
+    }
+
+    bool ranSection = false;
+
+    if (section == "all" || section == "hash") {
+        runHashBenchmark(itemCount);
+        ranSection = true;
+    }
+
+    if (section == "all" || section == "resize") {
+        runResizeBenchmark(itemCount);
+        ranSection = true;
+    }
+
+    if (section == "all" || section == "policy") {
+        runPolicyBenchmark(itemCount);
+        ranSection = true;
+    }
+
+    if (section == "all" || section == "cache") {
+        runCacheBenchmark(itemCount);
+        ranSection = true;
+    }
+
+    if (section == "all" || section == "memory") {
+        runMemoryBenchmark(itemCount);
+        ranSection = true;
+    }
+
+    if (section == "all" || section == "batch") {
+        runBatchBenchmark(itemCount);
+        ranSection = true;
+    }
+
+    if (section == "all" || section == "eviction") {
+        runEvictionBenchmark(itemCount);
+        ranSection = true;
+    }
+
+    if (section == "all" || section == "weight") {
+        runWeightedCapacityBenchmark(itemCount);
+        ranSection = true;
+    }
+
+    if (section == "all" || section == "ttl") {
+        runTimeToLiveBenchmark(itemCount);
+        ranSection = true;
+    }
+
+    if (section == "all" || section == "read") {
+        runReadPathBenchmark(itemCount);
+        ranSection = true;
+    }
+
+    if (section == "all" || section == "evictor") {
+        runBackgroundEvictionBenchmark(itemCount);
+        ranSection = true;
+    }
+
+    if (section == "all" || section == "ordered") {
+        runOrderedIndexBenchmark(itemCount);
+        ranSection = true;
+    }
+
+    if (!ranSection) {
+        std::cerr << "Unknown section: " << section << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,55 @@
+/**
+*
+* @file cache_entry.cpp - This file contains the constructors for CacheEntry.
+*
+* 10/18/26 - Created
+* 10/18/26 - Added default constructor
+* 10/18/26 - Entries start out CALLER_ALLOCATED
+* 10/18/26 - Entries start out unreferenced, in MAIN_SEGMENT
+* 10/18/26 - Entries start out with no S3-FIFO accesses
+* 10/18/26 - Entries start out with cost 1 and outside the GDSF heap
+* 10/18/26 - Entries start out with weight 0; added payloadBytes
+* 10/18/26 - Entries start out with no deadline and unscheduled
+*/
+
+#include "cache_entry.h"
+
+CacheEntry::CacheEntry() : CacheEntry(0) {}
+
+CacheEntry::CacheEntry(int value) : DllNode(value), hashLinks(value, this), treeLinks(value, this), allocation(CALLER_ALLOCATED), referenced(false), segment(MAIN_SEGMENT), frequency(0), cost(1.0), accessCount(0), priority(0.0), heapIndex(-1), weight(0), expiresAt(0), timerPrev(nullptr), timerNext(nullptr), timerBucket(-1) {}
+
+CacheEntry::CacheEntry(int myValue, std::string myFullName, std::string myAddress, std::string myCity, std::string myState, std::string myZip)
+    : DllNode(myValue, myFullName, myAddress, myCity, myState, myZip), hashLinks(myValue, this), treeLinks(myValue, this), allocation(CALLER_ALLOCATED), referenced(false), segment(MAIN_SEGMENT), frequency(0), cost(1.0), accessCount(0), priority(0.0), heapIndex(-1), weight(0), expiresAt(0), timerPrev(nullptr), timerNext(nullptr), timerBucket(-1) {}
+
+
+// Capacity of an empty string: the most characters kept inside the object itself
+static const size_t INLINE_STRING_CAPACITY = std::string().capacity();
+
+/**
+*
+* stringBytes
+*
+* function to return the heap buffer held by a string, including its terminator
+*
+* @param    text    string to measure
+*
+* @return   size in bytes, 0 for a string stored inside the object
+*/
+static size_t stringBytes(const std::string& text) {
+    return (text.capacity() > INLINE_STRING_CAPACITY) ? text.capacity() + 1 : 0;
+}
+
+/**
+*
+* payloadBytes
+*
+* function to return the heap memory held by an entry's payload strings; a string short
+* enough to be stored inside the object (small string optimization) costs nothing extra
+*
+* @param    entry   a cache entry
+*
+* @return   size in bytes
+*/
+size_t payloadBytes(const CacheEntry* entry) {
+    return stringBytes(entry->fullName) + stringBytes(entry->address) + stringBytes(entry->city) + stringBytes(entry->state) + stringBytes(entry->zip);
+}
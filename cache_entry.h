@@ -0,0 +1,84 @@
+/**
+*
+* cache_entry.h : This is the node class header file for CacheEntry, used in cache_manager.cpp
+*
+* 10/18/26 - Created; one allocation holds the payload and the list, hash chain and tree links
+* 10/18/26 - Added a default constructor so entries can be allocated as an array
+* 10/18/26 - Added allocation, which records how an entry must be freed
+* 10/18/26 - Added referenced, the CLOCK reference bit
+* 10/18/26 - Added segment, the CacheManager list an entry is on
+* 10/18/26 - Added frequency, the S3-FIFO access count
+* 10/18/26 - Added cost, accessCount, priority and heapIndex for GDSF
+* 10/18/26 - Added weight, and payloadBytes, the default EntryWeigher
+* 10/18/26 - Added expiresAt and the timer wheel links
+*/
+
+#ifndef _CACHE_ENTRY
+#define _CACHE_ENTRY
+
+#include <string>
+#include "dll_node.h"
+#include "hash_node.h"
+#include "tree_node.h"
+
+// How an entry was allocated, and so how CacheManager releases it
+enum EntryAllocation { CALLER_ALLOCATED = 0, PREALLOCATED = 1, RESOURCE_ALLOCATED = 2 };
+
+// Which of CacheManager's lists an entry is on; LRU and CLOCK only use MAIN_SEGMENT,
+// W-TinyLFU uses all three (MAIN_SEGMENT is its probation segment), ARC keeps
+// T1 on MAIN_SEGMENT and T2 on PROTECTED_SEGMENT, and S3-FIFO keeps its small
+// queue on WINDOW_SEGMENT and its main queue on MAIN_SEGMENT
+enum EntrySegment { MAIN_SEGMENT = 0, WINDOW_SEGMENT = 1, PROTECTED_SEGMENT = 2 };
+
+// Define a class for one cached item
+//
+// The DllNode base is the LRU list node and carries the payload. The chained hash
+// table and the tree link hashLinks and treeLinks in place instead of allocating
+// their own nodes; both point back at the entry through their fifoNode field, so
+// existing code that follows fifoNode keeps working. Entries are owned by
+// CacheManager, and the structures only unlink them (detach), never delete them.
+class CacheEntry : public DllNode {
+public:
+	HashNode hashLinks;			// chain links used by the CHAINED engine (unused by the open-addressing engines)
+	TreeNode treeLinks;			// red-black links used by the SelfBalancingTree
+	EntryAllocation allocation;	// CALLER_ALLOCATED (new) unless CacheManager allocated the entry itself
+	bool referenced;			// CLOCK reference bit: set by a hit, cleared as the hand passes
+	EntrySegment segment;		// list the entry is linked on
+	unsigned char frequency;	// S3-FIFO access count: raised by a hit up to 3, spent by the main queue's sweep
+	double cost;				// caller's cost of reloading the entry (1 unless given to add)
+	unsigned int accessCount;	// GDSF frequency: adds and hits since the entry was cached
+	double priority;			// GDSF priority: inflation + accessCount * cost / size
+	int heapIndex;				// position in the GDSF heap, -1 when not in it
+	size_t weight;				// bytes the entry was charged when it was linked or last updated
+	long long expiresAt;		// time (CacheOptions::clock) the entry stops being served; 0 = never
+	CacheEntry* timerPrev;		// neighbours in the TimerWheel bucket the entry is scheduled in
+	CacheEntry* timerNext;
+	int timerBucket;			// that bucket, -1 when the entry is not scheduled
+
+	// Default constructor for preallocated entries; key 0 and empty payload
+	CacheEntry();
+
+	CacheEntry(int value);
+
+	// Constructor to initialize an entry with a specific value and payload
+	CacheEntry(int value, std::string fullName, std::string address, std::string city, std::string state, std::string zip);
+};
+
+// Returns the bytes of an entry's payload that a byte-weighted cache should charge for
+// it, on top of the entry itself and its share of the index
+typedef size_t (*EntryWeigher)(const CacheEntry* entry);
+
+/**
+*
+* payloadBytes
+*
+* function to return the heap memory held by an entry's payload strings; a string short
+* enough to be stored inside the object (small string optimization) costs nothing extra
+*
+* @param    entry   a cache entry
+*
+* @return   size in bytes
+*/
+size_t payloadBytes(const CacheEntry* entry);
+
+#endif
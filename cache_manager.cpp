@@ -1,287 +1,1782 @@
-/**
-*
-* @author - Adrian Aquino
-* @file cache_manager.cpp - Implementation of the cache manager
-*
-* 04/20/25 - Imported file from Milestone 3
-* 04/21/25 - Added missing methods: getBst, printRange, sort; fixed output formatting
-* 05/17/25 - Modified by Adrian Aquino; changed getBst() to return SelfBalancingTree*
-* 05/21/25 - Modified by Adrian Aquino; updated for corrected red-black tree implementation
-*
-*/
-
-#include <iostream>
-#include <string>
-#include <fstream>
-#include "cache_manager.h"
-
-extern void logToFileAndConsole(std::string msg);
-extern std::ofstream& getOutFile();
-
-/**
-*
-* getTable
-*
-* Method to return the hash table
-*
-* @param    none
-*
-* @return	the hash table
-*/
-HashTable* CacheManager::getTable() {
-    return hashTable;
-}
-
-/**
-*
-* getList
-*
-* Method to return the FIFO list
-*
-* @param    none
-*
-* @return	the FIFO list
-*/
-DoublyLinkedList* CacheManager::getList() {
-    return doublyLinkedList;
-}
-
-/**
-*
-* getBst
-*
-* Method to return the BST
-*
-* @param    none
-*
-* @return	the BST
-*/
-SelfBalancingTree* CacheManager::getBst() {
-    return binarySearchTree;
-}
-
-/**
-*
-* getSize
-*
-* Method to return the number of items in the CacheManager
-*
-* @param    none
-*
-* @return	number of items in the CacheManager
-*/
-int CacheManager::getSize() {
-    return hashTable->getNumberOfItems();
-}
-
-/**
-*
-* isEmpty
-*
-* Method to check if CacheManager is empty
-*
-* @param    none
-*
-* @return   true if the CacheManager has zero entries, false otherwise
-*/
-bool CacheManager::isEmpty() {
-    return hashTable->isEmpty();
-}
-
-/**
-*
-* add
-*
-* Method to add a node to the CacheManager
-*
-* @param    curKey    key for this node
-* @param    myNode    new node to add to the table
-*
-* @return   true if success, false otherwise
-*/
-bool CacheManager::add(int curKey, DllNode* myNode) {
-    if (contains(curKey)) {
-        remove(curKey);
-    }
-
-    if (doublyLinkedList->getSize() >= maxCacheSize) {
-        if (!doublyLinkedList->isEmpty()) {
-            int oldestKey = doublyLinkedList->tail->key;
-            remove(oldestKey);
-        }
-    }
-
-    HashNode* newHashNode = new HashNode(curKey, myNode);
-    bool addedToHash = hashTable->add(curKey, newHashNode);
-
-    doublyLinkedList->insertAtHead(curKey, myNode);
-
-    binarySearchTree->addToTree(curKey, myNode);
-
-    return addedToHash;
-}
-
-/**
-*
-* remove
-*
-* Method to remove node with curKey
-*
-* @param    key     key of node to remove
-*
-* @return   true if success, false otherwise
-*/
-bool CacheManager::remove(int curKey) {
-    if (!hashTable->contains(curKey)) {
-        return false;
-    }
-
-    doublyLinkedList->remove(curKey);
-
-    binarySearchTree->removeNode(curKey);
-
-    return hashTable->remove(curKey);
-}
-
-/**
-*
-* clear
-*
-* Method to remove all entries from the CacheManager
-*
-* @param    none
-*
-* @return   nothing, but will delete all entries from the CacheManager
-*/
-void CacheManager::clear() {
-    doublyLinkedList->clear();
-    hashTable->clear();
-    binarySearchTree->clear();
-}
-
-/**
-*
-* getItem
-*
-* Method to retrieve item from the CacheManager
-*
-* @param    curKey  retrieve node from CacheManager with curKey value
-*
-* @return   pointer to the DllNode
-*/
-DllNode* CacheManager::getItem(int curKey) {
-    HashNode* hashNode = hashTable->getItem(curKey);
-    if (hashNode == nullptr) {
-        return nullptr;
-    }
-
-    doublyLinkedList->moveNodeToHead(curKey);
-
-    return hashNode->getFifoNode();
-}
-
-/**
-*
-* getMaxCacheSize
-*
-* Method to retrieve max size of cache from the CacheManager
-*
-* @param    none
-*
-* @return   max size of cache manager
-*/
-int CacheManager::getMaxCacheSize() {
-    return maxCacheSize;
-}
-
-/**
-*
-* contains
-*
-* Method to determine if a key value is in the cache
-*
-* @param    curKey  retrieve node from cacheManager with curKey value
-*
-* @return   true if exists, false otherwise
-*/
-bool CacheManager::contains(int curKey) {
-    bool result = hashTable->contains(curKey);
-
-    if (result) {
-        doublyLinkedList->moveNodeToHead(curKey);
-    }
-
-    return result;
-}
-
-/**
-*
-* printCache
-*
-* Method to print out the cache information
-*
-* @param    none
-*
-* @return   nothing, but prints out the cache information
-*/
-void CacheManager::printCache() {
-    std::ofstream& outFile = getOutFile();
-
-    std::cout << "Printing out the cache: " << std::endl;
-    outFile << "Printing out the cache: " << std::endl;
-
-    std::cout << "Here are the FIFO List contents: " << std::endl;
-    outFile << "Here are the FIFO List contents: " << std::endl;
-
-    if (doublyLinkedList->isEmpty()) {
-        std::cout << "Empty list" << std::endl;
-        outFile << "Empty list" << std::endl;
-    } else {
-        DllNode* current = doublyLinkedList->head;
-        while (current != nullptr) {
-            std::cout << current->key << " " << std::endl;
-            outFile << current->key << " " << std::endl;
-            current = current->next;
-        }
-    }
-
-    std::cout << "End of FIFO List" << std::endl;
-    outFile << "End of FIFO List" << std::endl;
-
-    hashTable->printTable();
-}
-
-/**
-*
-* printRange
-*
-* Method to traverse and print out the cache information given a low and high value.
-*
-* @param    low    the lower bound (inclusive) of the range to print
-* @param    high   the higher bound (inclusive) of the range to print
-*
-* @return   nothing, but prints out the keys for the cache between low and high
-*/
-void CacheManager::printRange(int low, int high) {
-    binarySearchTree->printRange(low, high);
-}
-
-/**
-*
-* sort
-*
-* Method to print out the cache information in sorted order
-*
-* @param    ascending   true, if output is to be in ascending order, false for descending order
-*
-* @return   nothing, but prints out the keys for the cache in sorted order
-*/
-void CacheManager::sort(bool ascending) {
-    if (ascending) {
-        binarySearchTree->printInOrder();
-    } else {
-        binarySearchTree->printReverseOrder();
-    }
-
-    binarySearchTree->printBreadthFirst();
+/**
+*
+* @author - Adrian Aquino
+* @file cache_manager.cpp - Implementation of the cache manager
+*
+* 04/20/25 - Imported file from Milestone 3
+* 04/21/25 - Added missing methods: getBst, printRange, sort; fixed output formatting
+* 05/17/25 - Modified by Adrian Aquino; changed getBst() to return SelfBalancingTree*
+* 05/21/25 - Modified by Adrian Aquino; updated for corrected red-black tree implementation
+* 10/18/26 - getItem, contains, remove and eviction now use the FIFO node held by the HashNode instead of scanning the list
+* 10/18/26 - hash table accessed through HashIndex so either engine can be used
+* 10/18/26 - add probes the hash table and tree once each (findOrInsert); an existing key is updated in place
+* 10/18/26 - each cached item is one CacheEntry whose hash and tree links are attached in place; the
+*            structures only detach entries and CacheManager deletes them; added the destructor
+* 10/18/26 - entries are released through releaseEntry, which recycles preallocated ones; added add(curKey, payload)
+* 10/18/26 - entries the manager allocates come from the configured memory resource
+* 10/18/26 - added getItems, containsMany and addMany
+* 10/18/26 - added the CLOCK_EVICTION policy: hits set a reference bit and a hand sweeps for victims
+* 10/18/26 - added the TINY_LFU_EVICTION policy: window LRU, frequency-sketch admission, segmented main LRU
+* 10/18/26 - added the ARC_EVICTION policy and getArcTarget
+* 10/18/26 - added the S3_FIFO_EVICTION policy
+* 10/18/26 - added the GDSF_EVICTION policy and the cost argument of add
+* 10/18/26 - added byte-weighted capacity: entries are weighed as they are linked, and add evicts
+*            in policy order until the total is within maxWeightBytes; GDSF sizes entries by weight
+* 10/18/26 - added per-entry time to live: deadlines are kept on a TimerWheel that add advances, and
+*            getItem, contains and the batch lookups drop an expired entry instead of returning it
+* 10/18/26 - added peek, containsNoTouch and peekMany, which write nothing, and promote, which applies their hits
+* 10/18/26 - added getItemDeferred, isDrainDue and drainHits; add drains buffered hits first, clear discards them
+* 10/18/26 - added the background evictor (runEvictor, requestEviction) and evictTo
+* 10/18/26 - the tree is an OrderedIndex (red-black tree or B+tree, picked through CacheOptions); getBst returns it
+* 10/18/26 - added rank, select, countInRange and percentile, answered by the ordered index
+* 10/18/26 - added openRange
+* 10/18/26 - addMany bulk loads the ordered index (attachSorted) when a sorted batch fills an empty cache
+* 10/18/26 - clear() also forgets the ghost lists (ARC and S3-FIFO) and the ARC target
+* 10/18/26 - add sets the entry's key to curKey, so the tree is keyed like the hash index
+* 10/18/26 - added getInflation
+*
+*/
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <fstream>
+#include <utility>
+#include "cache_manager.h"
+
+extern void logToFileAndConsole(std::string msg);
+extern std::ofstream& getOutFile();
+
+// Batched calls prefetch this many keys ahead of probing them; a larger group would let
+// early prefetches be evicted before they are used
+static const int PREFETCH_GROUP_SIZE = 16;
+
+// The background evictor releases the cache lock after this many victims, so a foreground
+// call waits for at most one batch
+static const int BACKGROUND_EVICTION_BATCH = 64;
+
+CacheManager::~CacheManager() {
+    if (evictorThread.joinable()) {
+        {
+            std::lock_guard<std::mutex> guard(evictorMutex);
+            evictorStop = true;
+        }
+        evictorWake.notify_one();
+        evictorThread.join();
+    }
+
+    clear();
+    delete hashTable;
+    delete doublyLinkedList;
+    delete windowList;
+    delete protectedList;
+    delete frequencySketch;
+    delete recencyGhosts;
+    delete frequencyGhosts;
+    delete priorityHeap;
+    delete timerWheel;
+    delete accessBuffer;
+    delete binarySearchTree;
+
+    if (entryPool != nullptr) {
+        for (int i = 0; i < entryPoolSize; i++) {
+            entryPool[i].~CacheEntry();
+        }
+        deallocateArray(memoryResource != nullptr ? memoryResource : std::pmr::new_delete_resource(), entryPool, entryPoolSize);
+    }
+}
+
+/**
+*
+* preallocate
+*
+* Method to allocate entryCount entries in one block and put them all on the free list
+*
+* @param    entryCount    number of entries to allocate
+*
+* @return   nothing
+*/
+void CacheManager::preallocate(int entryCount) {
+    // Raw storage so the entries can be constructed (and later destroyed) the same way with or without a resource
+    entryPool = allocateArray<CacheEntry>(memoryResource != nullptr ? memoryResource : std::pmr::new_delete_resource(), entryCount);
+    entryPoolSize = entryCount;
+
+    for (int i = entryCount - 1; i >= 0; i--) {
+        new (&entryPool[i]) CacheEntry();
+        entryPool[i].allocation = PREALLOCATED;
+        entryPool[i].next = freeEntries;
+        freeEntries = &entryPool[i];
+    }
+}
+
+/**
+*
+* acquireEntry
+*
+* Method to take an entry from the free list, or allocate one from memoryResource if the list is empty
+*
+* @param    none
+*
+* @return   an entry that is not linked into any structure
+*/
+CacheEntry* CacheManager::acquireEntry() {
+    if (freeEntries == nullptr) {
+        CacheEntry* entry = newObject<CacheEntry>(memoryResource, 0);
+        entry->allocation = RESOURCE_ALLOCATED;
+        return entry;
+    }
+
+    CacheEntry* entry = freeEntries;
+    freeEntries = static_cast<CacheEntry*>(entry->next);
+    entry->next = nullptr;
+
+    return entry;
+}
+
+/**
+*
+* releaseEntry
+*
+* Method to return an entry that has been detached from every structure; preallocated entries go
+* back on the free list, the rest are freed the way their allocation field says
+*
+* @param    entry    the entry to release
+*
+* @return   nothing
+*/
+void CacheManager::releaseEntry(CacheEntry* entry) {
+    if (entry->allocation == CALLER_ALLOCATED) {
+        delete entry;
+        return;
+    }
+
+    if (entry->allocation == RESOURCE_ALLOCATED) {
+        deleteObject(memoryResource, entry);
+        return;
+    }
+
+    // The payload strings keep their buffers, so refilling the entry usually does not allocate
+    entry->prev = nullptr;
+    entry->next = freeEntries;
+    freeEntries = entry;
+}
+
+/**
+*
+* recordHit
+*
+* Method to note that an entry was used: LRU moves it to the head of the list, CLOCK only
+* sets its reference bit, so a hit on an entry whose bit is already set writes nothing
+*
+* @param    fifoNode    the entry that was hit
+*
+* @return   nothing
+*/
+void CacheManager::recordHit(DllNode* fifoNode) {
+    if (evictionPolicy == CLOCK_EVICTION) {
+        CacheEntry* entry = static_cast<CacheEntry*>(fifoNode);
+
+        // Test first so hot entries, whose bit is usually set, keep their cache line clean
+        if (!entry->referenced) {
+            entry->referenced = true;
+        }
+        return;
+    }
+
+    if (evictionPolicy == TINY_LFU_EVICTION) {
+        recordTinyLfuHit(static_cast<CacheEntry*>(fifoNode));
+        return;
+    }
+
+    // S3-FIFO: like CLOCK, a hit never moves the entry, and a saturated count is not rewritten
+    if (evictionPolicy == S3_FIFO_EVICTION) {
+        CacheEntry* entry = static_cast<CacheEntry*>(fifoNode);
+
+        if (entry->frequency < 3) {
+            entry->frequency++;
+        }
+        return;
+    }
+
+    if (evictionPolicy == GDSF_EVICTION) {
+        CacheEntry* entry = static_cast<CacheEntry*>(fifoNode);
+
+        entry->accessCount++;
+        refreshGdsfPriority(entry);
+        return;
+    }
+
+    // ARC: any hit makes the entry the most recent in T2
+    if (evictionPolicy == ARC_EVICTION) {
+        CacheEntry* entry = static_cast<CacheEntry*>(fifoNode);
+
+        if (entry->segment == PROTECTED_SEGMENT) {
+            protectedList->moveNodeToHead(entry);
+        } else {
+            doublyLinkedList->unlink(entry);
+            entry->segment = PROTECTED_SEGMENT;
+            protectedList->insertAtHead(entry->key, entry);
+        }
+        return;
+    }
+
+    doublyLinkedList->moveNodeToHead(fifoNode);
+}
+
+/**
+*
+* listOf
+*
+* Method to return the list an entry is linked on
+*
+* @param    entry    a cached entry
+*
+* @return   doublyLinkedList, windowList or protectedList, by the entry's segment
+*/
+DoublyLinkedList* CacheManager::listOf(CacheEntry* entry) {
+    if (entry->segment == WINDOW_SEGMENT) {
+        return windowList;
+    }
+
+    if (entry->segment == PROTECTED_SEGMENT) {
+        return protectedList;
+    }
+
+    return doublyLinkedList;
+}
+
+/**
+*
+* recordTinyLfuHit
+*
+* Method to count a hit in the sketch and promote the entry: within the window, from probation
+* to protected, or within protected; a protected list over capacity demotes its tail to probation
+*
+* @param    entry    the entry that was hit
+*
+* @return   nothing
+*/
+void CacheManager::recordTinyLfuHit(CacheEntry* entry) {
+    frequencySketch->increment(entry->key);
+
+    if (entry->segment != MAIN_SEGMENT) {
+        listOf(entry)->moveNodeToHead(entry);
+        return;
+    }
+
+    doublyLinkedList->unlink(entry);
+    entry->segment = PROTECTED_SEGMENT;
+    protectedList->insertAtHead(entry->key, entry);
+
+    if (protectedList->getSize() > protectedCapacity) {
+        DllNode* demoted = protectedList->tail;
+        protectedList->unlink(demoted);
+        static_cast<CacheEntry*>(demoted)->segment = MAIN_SEGMENT;
+        doublyLinkedList->insertAtHead(demoted->key, demoted);
+    }
+}
+
+/**
+*
+* admitFromWindow
+*
+* Method to move the window's oldest entry into probation once the window is over capacity and,
+* if the cache is then over capacity, evict whichever of that candidate and the main victim
+* (probation tail, else protected tail) the sketch has seen less often
+*
+* @param    none
+*
+* @return   nothing
+*/
+void CacheManager::admitFromWindow() {
+    // The window only grows through add and main only through the window, so a cache
+    // that is over capacity always has a window that is over capacity too
+    if (windowList->getSize() <= windowCapacity) {
+        return;
+    }
+
+    DllNode* candidate = windowList->tail;
+    windowList->unlink(candidate);
+    static_cast<CacheEntry*>(candidate)->segment = MAIN_SEGMENT;
+    doublyLinkedList->insertAtHead(candidate->key, candidate);
+
+    if (getSize() <= maxCacheSize) {
+        return;
+    }
+
+    DllNode* victim = (doublyLinkedList->tail != candidate) ? doublyLinkedList->tail : protectedList->tail;
+
+    // Ties go to the victim: a newcomer has to have been seen more often to get in
+    if (victim == nullptr || frequencySketch->frequency(candidate->key) <= frequencySketch->frequency(victim->key)) {
+        remove(candidate->key);
+    } else {
+        remove(victim->key);
+    }
+}
+
+/**
+*
+* linkClockEntry
+*
+* Method to put a new entry on the CLOCK ring just behind the hand, so the hand reaches it
+* last; a full cache first evicts a victim, so the new entry is never the one chosen
+*
+* @param    entry    the new entry, already in the hash table but not yet on the list
+*
+* @return   nothing
+*/
+void CacheManager::linkClockEntry(CacheEntry* entry) {
+    if (doublyLinkedList->getSize() >= maxCacheSize) {
+        evictClockVictim();
+    }
+
+    // A recycled entry may still carry the bit from its last use
+    entry->referenced = false;
+
+    // The hand moves from tail toward head, so the entry it passed last is clockHand->next;
+    // with no hand it starts at the tail, and the entry it reaches last is the head
+    if (clockHand == nullptr) {
+        doublyLinkedList->insertAtHead(entry->key, entry);
+    } else {
+        doublyLinkedList->insertAfter(clockHand, entry);
+    }
+}
+
+/**
+*
+* evictClockVictim
+*
+* Method to sweep the hand from tail toward head, wrapping around, clearing reference bits
+* until it finds an entry whose bit is clear, and remove that entry
+*
+* @param    none
+*
+* @return   nothing
+*/
+void CacheManager::evictClockVictim() {
+    DllNode* candidate = (clockHand != nullptr) ? clockHand : doublyLinkedList->tail;
+
+    // Ends within one revolution: by then every bit the hand passed has been cleared
+    while (static_cast<CacheEntry*>(candidate)->referenced) {
+        static_cast<CacheEntry*>(candidate)->referenced = false;
+        candidate = (candidate->prev != nullptr) ? candidate->prev : doublyLinkedList->tail;
+    }
+
+    // remove moves the hand on past the victim
+    clockHand = candidate;
+    remove(candidate->key);
+}
+
+/**
+*
+* linkArcEntry
+*
+* Method to put a new entry in ARC: a key found in B1 or B2 first moves p, then goes to T2;
+* any other key goes to T1 after the ghost lists are trimmed; a full cache evicts through
+* replaceArcEntry before the entry is linked
+*
+* @param    entry    the new entry, already in the hash table but not yet on a list
+*
+* @return   nothing
+*/
+void CacheManager::linkArcEntry(CacheEntry* entry) {
+    int t1 = doublyLinkedList->getSize();
+    int t2 = protectedList->getSize();
+    int b1 = recencyGhosts->getSize();
+    int b2 = frequencyGhosts->getSize();
+    bool full = (t1 + t2 >= maxCacheSize);
+
+    // A ghost hit means the key would still be cached had its list been larger; p moves
+    // faster when the other ghost list is the bigger one
+    bool inRecencyGhosts = recencyGhosts->remove(entry->key);
+    bool inFrequencyGhosts = !inRecencyGhosts && frequencyGhosts->remove(entry->key);
+
+    if (inRecencyGhosts) {
+        arcTarget = std::min(maxCacheSize, arcTarget + std::max(b2 / b1, 1));
+    } else if (inFrequencyGhosts) {
+        arcTarget = std::max(0, arcTarget - std::max(b1 / b2, 1));
+    }
+
+    if (inRecencyGhosts || inFrequencyGhosts) {
+        if (full) {
+            replaceArcEntry(inFrequencyGhosts);
+        }
+
+        entry->segment = PROTECTED_SEGMENT;
+        protectedList->insertAtHead(entry->key, entry);
+        return;
+    }
+
+    // A new key: keep T1 + B1 within the cache size and all four lists within twice it
+    if (t1 + b1 >= maxCacheSize) {
+        if (t1 < maxCacheSize) {
+            recencyGhosts->removeOldest();
+            if (full) {
+                replaceArcEntry(false);
+            }
+        } else {
+            // B1 is empty and T1 fills the cache; its LRU entry leaves without a ghost
+            remove(doublyLinkedList->tail->key);
+        }
+    } else if (t1 + t2 + b1 + b2 >= maxCacheSize) {
+        if (t1 + t2 + b1 + b2 >= 2 * maxCacheSize) {
+            frequencyGhosts->removeOldest();
+        }
+        if (full) {
+            replaceArcEntry(false);
+        }
+    }
+
+    entry->segment = MAIN_SEGMENT;
+    doublyLinkedList->insertAtHead(entry->key, entry);
+}
+
+/**
+*
+* replaceArcEntry
+*
+* Method to evict the LRU entry of T1 into B1 if T1 is larger than p (or equal to it and the
+* new key came from B2), otherwise the LRU entry of T2 into B2
+*
+* @param    fromFrequencyGhosts     true if the key being added was found in B2
+*
+* @return   nothing
+*/
+void CacheManager::replaceArcEntry(bool fromFrequencyGhosts) {
+    int t1 = doublyLinkedList->getSize();
+
+    if (t1 > 0 && (t1 > arcTarget || (fromFrequencyGhosts && t1 == arcTarget) || protectedList->isEmpty())) {
+        int victim = doublyLinkedList->tail->key;
+        remove(victim);
+        recencyGhosts->insertAtHead(victim);
+    } else {
+        int victim = protectedList->tail->key;
+        remove(victim);
+        frequencyGhosts->insertAtHead(victim);
+    }
+}
+
+/**
+*
+* linkS3FifoEntry
+*
+* Method to put a new entry in S3-FIFO: a full cache first evicts one entry, then the entry
+* goes to the main queue if its key is in the ghost queue and to the small queue otherwise
+*
+* @param    entry    the new entry, already in the hash table but not yet on a list
+*
+* @return   nothing
+*/
+void CacheManager::linkS3FifoEntry(CacheEntry* entry) {
+    if (windowList->getSize() + doublyLinkedList->getSize() >= maxCacheSize) {
+        evictS3FifoEntry();
+    }
+
+    entry->frequency = 0;
+
+    // A ghost key was evicted from the small queue not long ago, so it is not a one-hit key
+    if (recencyGhosts->remove(entry->key)) {
+        entry->segment = MAIN_SEGMENT;
+        doublyLinkedList->insertAtHead(entry->key, entry);
+    } else {
+        entry->segment = WINDOW_SEGMENT;
+        windowList->insertAtHead(entry->key, entry);
+    }
+}
+
+/**
+*
+* evictS3FifoEntry
+*
+* Method to evict one entry: from the small queue while it is at its share of the cache, where
+* an entry that was hit moves to main instead and one that was not leaves for the ghost queue;
+* otherwise from main, which reinserts an entry that was hit and spends one of its accesses
+*
+* @param    none
+*
+* @return   nothing
+*/
+void CacheManager::evictS3FifoEntry() {
+    // Ends once an entry leaves: every pass moves an entry out of the small queue or lowers a main count
+    for (;;) {
+        if (windowList->getSize() >= windowCapacity || doublyLinkedList->isEmpty()) {
+            CacheEntry* oldest = static_cast<CacheEntry*>(windowList->tail);
+
+            if (oldest->frequency > 0) {
+                windowList->unlink(oldest);
+                oldest->segment = MAIN_SEGMENT;
+                oldest->frequency = 0;
+                doublyLinkedList->insertAtHead(oldest->key, oldest);
+                continue;
+            }
+
+            // The ghost queue remembers as many keys as the main queue holds entries
+            int victim = oldest->key;
+            remove(victim);
+            recencyGhosts->insertAtHead(victim);
+            while (recencyGhosts->getSize() > maxCacheSize - windowCapacity) {
+                recencyGhosts->removeOldest();
+            }
+            return;
+        }
+
+        CacheEntry* oldest = static_cast<CacheEntry*>(doublyLinkedList->tail);
+
+        if (oldest->frequency > 0) {
+            oldest->frequency--;
+            doublyLinkedList->moveNodeToHead(oldest);
+            continue;
+        }
+
+        remove(oldest->key);
+        return;
+    }
+}
+
+/**
+*
+* linkGdsfEntry
+*
+* Method to put a new entry in the GDSF heap with one access; a full cache first evicts the
+* lowest-priority entry and raises the inflation clock to its priority
+*
+* @param    entry    the new entry, already in the hash table but not yet on a list
+*
+* @return   nothing
+*/
+void CacheManager::linkGdsfEntry(CacheEntry* entry) {
+    if (priorityHeap->getSize() >= maxCacheSize) {
+        evictVictim();
+    }
+
+    entry->accessCount = 1;
+    entry->priority = inflation + entry->cost / entry->weight;
+    priorityHeap->push(entry);
+
+    // The list only keeps the entries together for printCache and clear; its order is not used
+    doublyLinkedList->insertAtHead(entry->key, entry);
+}
+
+/**
+*
+* refreshGdsfPriority
+*
+* Method to recompute an entry's GDSF priority from the current clock, its access count,
+* cost and size, and move it to its place in the heap
+*
+* @param    entry    an entry in the heap
+*
+* @return   nothing
+*/
+void CacheManager::refreshGdsfPriority(CacheEntry* entry) {
+    entry->priority = inflation + entry->accessCount * entry->cost / entry->weight;
+    priorityHeap->update(entry);
+}
+
+/**
+*
+* chargeEntry
+*
+* Method to weigh an entry (overhead plus weigher bytes) and add it to the total, replacing
+* the weight it was last charged if it is already cached
+*
+* @param    entry    the entry, new or with a changed payload
+*
+* @return   nothing
+*/
+void CacheManager::chargeEntry(CacheEntry* entry) {
+    totalWeight -= entry->weight;
+    entry->weight = entryOverhead + weigher(entry);
+    totalWeight += entry->weight;
+}
+
+/**
+*
+* evictVictim
+*
+* Method to evict one entry, the one the eviction policy would pick to make room for an add
+*
+* @param    none
+*
+* @return   nothing; the cache must not be empty
+*/
+void CacheManager::evictVictim() {
+    if (evictionPolicy == CLOCK_EVICTION) {
+        evictClockVictim();
+    } else if (evictionPolicy == ARC_EVICTION) {
+        // Moves an entry from T1 or T2 to its ghost list, so T1 + B1 and the four lists' total do not grow
+        replaceArcEntry(false);
+    } else if (evictionPolicy == S3_FIFO_EVICTION) {
+        evictS3FifoEntry();
+    } else if (evictionPolicy == GDSF_EVICTION) {
+        CacheEntry* victim = priorityHeap->top();
+        inflation = victim->priority;
+        remove(victim->key);
+    } else if (evictionPolicy == TINY_LFU_EVICTION) {
+        // Probation first, then protected; the window goes last, so new keys keep their chance to be admitted
+        DllNode* victim = doublyLinkedList->tail;
+        if (victim == nullptr) {
+            victim = (protectedList->tail != nullptr) ? protectedList->tail : windowList->tail;
+        }
+        remove(victim->key);
+    } else {
+        remove(doublyLinkedList->tail->key);
+    }
+}
+
+/**
+*
+* evictToWeightBudget
+*
+* Method to evict entries in policy order until the cached bytes are within maxWeightBytes;
+* does nothing when the cache is limited by entry count only
+*
+* @param    none
+*
+* @return   nothing
+*/
+void CacheManager::evictToWeightBudget() {
+    // An entry heavier than the whole budget is evicted too, so the budget is never exceeded after an add
+    while (maxWeightBytes > 0 && totalWeight > maxWeightBytes && !isEmpty()) {
+        evictVictim();
+    }
+}
+
+/**
+*
+* setExpiration
+*
+* Method to give a cached entry a new deadline, scheduling it on the timer wheel, or to take
+* its deadline away
+*
+* @param    entry        a cached entry
+* @param    expiresAt    deadline in clock milliseconds, or 0 for none
+*
+* @return   nothing
+*/
+void CacheManager::setExpiration(CacheEntry* entry, long long expiresAt) {
+    entry->expiresAt = expiresAt;
+
+    if (expiresAt != 0) {
+        timerWheel->schedule(entry);
+    } else if (entry->timerBucket >= 0) {
+        timerWheel->cancel(entry);
+    }
+}
+
+/**
+*
+* isExpired
+*
+* Method to check if an entry's deadline has passed; the clock is only read for entries that have one
+*
+* @param    entry    a cached entry
+*
+* @return   true if the entry must not be served, false otherwise
+*/
+bool CacheManager::isExpired(const CacheEntry* entry) const {
+    return entry->expiresAt != 0 && entry->expiresAt <= clock();
+}
+
+/**
+*
+* expireUntil
+*
+* Method to advance the timer wheel to now and remove every entry it reports as due
+*
+* @param    now     current clock time in milliseconds
+*
+* @return   number of entries removed
+*/
+int CacheManager::expireUntil(long long now) {
+    int expiredCount = 0;
+
+    CacheEntry* entry = timerWheel->advance(now);
+    while (entry != nullptr) {
+        CacheEntry* next = entry->timerNext;
+        entry->timerNext = nullptr;
+        remove(entry->key);
+        expiredCount++;
+        entry = next;
+    }
+
+    return expiredCount;
+}
+
+/**
+*
+* getTable
+*
+* Method to return the hash table
+*
+* @param    none
+*
+* @return	the hash table
+*/
+HashIndex* CacheManager::getTable() {
+    return hashTable;
+}
+
+/**
+*
+* getList
+*
+* Method to return the FIFO list
+*
+* @param    none
+*
+* @return	the FIFO list
+*/
+DoublyLinkedList* CacheManager::getList() {
+    return doublyLinkedList;
+}
+
+/**
+*
+* getBst
+*
+* Method to return the ordered index (a SelfBalancingTree unless options.orderedIndex picked another engine)
+*
+* @param    none
+*
+* @return	the ordered index
+*/
+OrderedIndex* CacheManager::getBst() {
+    return binarySearchTree;
+}
+
+/**
+*
+* getSize
+*
+* Method to return the number of items in the CacheManager
+*
+* @param    none
+*
+* @return	number of items in the CacheManager
+*/
+int CacheManager::getSize() {
+    return hashTable->getNumberOfItems();
+}
+
+/**
+*
+* isEmpty
+*
+* Method to check if CacheManager is empty
+*
+* @param    none
+*
+* @return   true if the CacheManager has zero entries, false otherwise
+*/
+bool CacheManager::isEmpty() {
+    return hashTable->isEmpty();
+}
+
+/**
+*
+* add
+*
+* Method to add an entry to the CacheManager, which takes ownership of it; if curKey is already
+* cached, the existing entry takes entry's payload and cost and counts as a hit, and entry is released;
+* with maxWeightBytes set, entries are then evicted in policy order until the cache is within it; an entry
+* heavier than the whole budget is evicted too, so such an add empties the cache and still returns true
+*
+* @param    curKey    key for this entry
+* @param    entry     new entry, allocated with new; its key is set to curKey
+* @param    cost      cost of reloading the entry; only GDSF_EVICTION uses it
+*
+* @return   true if success, false otherwise
+*/
+bool CacheManager::add(int curKey, CacheEntry* entry, double cost) {
+    return add(curKey, entry, std::chrono::milliseconds::zero(), cost);
+}
+
+/**
+*
+* add
+*
+* Method to add an entry that expires ttl after now; once expired it is no longer returned
+* by getItem or contains, and the timer wheel removes it on a later add or expireEntries.
+* Updating a cached key gives it the new deadline.
+*
+* @param    curKey    key for this entry
+* @param    entry     new entry, allocated with new; its key is set to curKey
+* @param    ttl       time to live; zero or less means the entry does not expire
+* @param    cost      cost of reloading the entry; only GDSF_EVICTION uses it
+*
+* @return   true if success, false otherwise
+*/
+bool CacheManager::add(int curKey, CacheEntry* entry, std::chrono::milliseconds ttl, double cost) {
+    // The hash index, lists and tree all key the entry by curKey
+    entry->key = curKey;
+
+    // Buffered hits go first, so the victim is picked on recency as of this add
+    if (accessBuffer->hasPending()) {
+        drainHits();
+    }
+
+    // The clock is only read when an entry has or gets a deadline
+    long long expiresAt = 0;
+    if (ttl.count() > 0 || timerWheel->getSize() > 0) {
+        long long now = clock();
+        expireUntil(now);
+        if (ttl.count() > 0) {
+            expiresAt = now + ttl.count();
+        }
+    }
+
+    bool inserted;
+    DllNode** fifoSlot = hashTable->findOrAttach(curKey, entry, inserted);
+
+    if (!inserted) {
+        CacheEntry* existing = static_cast<CacheEntry*>(*fifoSlot);
+
+        // The hash, list and tree links stay put; only the payload changes. Swapping hands
+        // the old buffers to entry, so a recycled entry keeps them for its next use.
+        if (existing != entry) {
+            existing->fullName.swap(entry->fullName);
+            existing->address.swap(entry->address);
+            existing->city.swap(entry->city);
+            existing->state.swap(entry->state);
+            existing->zip.swap(entry->zip);
+            releaseEntry(entry);
+        }
+
+        existing->cost = cost;
+        chargeEntry(existing);
+        setExpiration(existing, expiresAt);
+        recordHit(existing);
+        evictToWeightBudget();
+        return true;
+    }
+
+    entry->cost = cost;
+    entry->weight = 0;
+    chargeEntry(entry);
+
+    if (evictionPolicy == CLOCK_EVICTION) {
+        linkClockEntry(entry);
+    } else if (evictionPolicy == ARC_EVICTION) {
+        linkArcEntry(entry);
+    } else if (evictionPolicy == S3_FIFO_EVICTION) {
+        linkS3FifoEntry(entry);
+    } else if (evictionPolicy == GDSF_EVICTION) {
+        linkGdsfEntry(entry);
+    } else if (evictionPolicy == TINY_LFU_EVICTION) {
+        frequencySketch->increment(curKey);
+        entry->segment = WINDOW_SEGMENT;
+        windowList->insertAtHead(curKey, entry);
+    } else {
+        doublyLinkedList->insertAtHead(curKey, entry);
+    }
+
+    if (!deferTreeAttach) {
+        binarySearchTree->attach(entry);
+    }
+
+    setExpiration(entry, expiresAt);
+
+    // LRU: the new key is at the head, so the tail is the oldest entry and never curKey
+    // (CLOCK, ARC, S3-FIFO and GDSF already made room before linking; W-TinyLFU only evicts from outside the window)
+    if (evictionPolicy == TINY_LFU_EVICTION) {
+        admitFromWindow();
+    } else if (doublyLinkedList->getSize() > maxCacheSize) {
+        remove(doublyLinkedList->tail->key);
+    }
+
+    evictToWeightBudget();
+
+    if (evictionLock != nullptr && getSize() > highWatermark) {
+        requestEviction();
+    }
+
+    return true;
+}
+
+/**
+*
+* add
+*
+* Method to add a plain DllNode; its payload is moved into an entry from acquireEntry and myNode is deleted
+*
+* @param    curKey    key for this node
+* @param    myNode    new node, allocated with new (not a CacheEntry)
+*
+* @return   true if success, false otherwise
+*/
+bool CacheManager::add(int curKey, DllNode* myNode) {
+    CacheEntry* entry = acquireEntry();
+
+    entry->key = curKey;
+    entry->fullName.swap(myNode->fullName);
+    entry->address.swap(myNode->address);
+    entry->city.swap(myNode->city);
+    entry->state.swap(myNode->state);
+    entry->zip.swap(myNode->zip);
+    delete myNode;
+
+    return add(curKey, entry);
+}
+
+/**
+*
+* add
+*
+* Method to add a plain DllNode that expires ttl after now, as add(curKey, myNode) does
+*
+* @param    curKey    key for this node
+* @param    myNode    new node, allocated with new (not a CacheEntry)
+* @param    ttl       time to live; zero or less means the node does not expire
+*
+* @return   true if success, false otherwise
+*/
+bool CacheManager::add(int curKey, DllNode* myNode, std::chrono::milliseconds ttl) {
+    CacheEntry* entry = acquireEntry();
+
+    entry->key = curKey;
+    entry->fullName.swap(myNode->fullName);
+    entry->address.swap(myNode->address);
+    entry->city.swap(myNode->city);
+    entry->state.swap(myNode->state);
+    entry->zip.swap(myNode->zip);
+    delete myNode;
+
+    return add(curKey, entry, ttl);
+}
+
+/**
+*
+* add
+*
+* Method to copy a payload into an entry taken from the free list and add it; with
+* preallocateEntries set, a full cache adds without allocating or freeing an entry
+*
+* @param    curKey      key for this entry
+* @param    fullName    payload fields copied into the entry
+* @param    address
+* @param    city
+* @param    state
+* @param    zip
+* @param    cost        cost of reloading the entry; only GDSF_EVICTION uses it
+*
+* @return   true if success, false otherwise
+*/
+bool CacheManager::add(int curKey, const std::string& fullName, const std::string& address, const std::string& city, const std::string& state, const std::string& zip, double cost) {
+    CacheEntry* entry = acquireEntry();
+
+    entry->key = curKey;
+    entry->fullName.assign(fullName);
+    entry->address.assign(address);
+    entry->city.assign(city);
+    entry->state.assign(state);
+    entry->zip.assign(zip);
+
+    return add(curKey, entry, cost);
+}
+
+/**
+*
+* add
+*
+* Method to copy a payload into an entry taken from the free list and add it with a time to live
+*
+* @param    curKey      key for this entry
+* @param    fullName    payload fields copied into the entry
+* @param    address
+* @param    city
+* @param    state
+* @param    zip
+* @param    ttl         time to live; zero or less means the entry does not expire
+* @param    cost        cost of reloading the entry; only GDSF_EVICTION uses it
+*
+* @return   true if success, false otherwise
+*/
+bool CacheManager::add(int curKey, const std::string& fullName, const std::string& address, const std::string& city, const std::string& state, const std::string& zip, std::chrono::milliseconds ttl, double cost) {
+    CacheEntry* entry = acquireEntry();
+
+    entry->key = curKey;
+    entry->fullName.assign(fullName);
+    entry->address.assign(address);
+    entry->city.assign(city);
+    entry->state.assign(state);
+    entry->zip.assign(zip);
+
+    return add(curKey, entry, ttl, cost);
+}
+
+/**
+*
+* remove
+*
+* Method to remove node with curKey
+*
+* @param    key     key of node to remove
+*
+* @return   true if success, false otherwise
+*/
+bool CacheManager::remove(int curKey) {
+    DllNode* fifoNode;
+    if (!hashTable->detach(curKey, fifoNode)) {
+        return false;
+    }
+
+    CacheEntry* entry = static_cast<CacheEntry*>(fifoNode);
+
+    // Keep the hand on the ring: it moves on to the entry it would have examined next
+    if (entry == clockHand) {
+        clockHand = entry->prev;
+    }
+
+    if (priorityHeap != nullptr) {
+        priorityHeap->remove(entry);
+    }
+
+    if (entry->timerBucket >= 0) {
+        timerWheel->cancel(entry);
+    }
+
+    listOf(entry)->unlink(entry);
+
+    binarySearchTree->detach(entry);
+
+    totalWeight -= entry->weight;
+
+    releaseEntry(entry);
+
+    return true;
+}
+
+/**
+*
+* clear
+*
+* Method to remove all entries from the CacheManager
+*
+* @param    none
+*
+* @return   nothing, but will delete all entries from the CacheManager
+*/
+void CacheManager::clear() {
+    // Every entry is on one of the lists, so the structures can be emptied first and the entries freed from them
+    DllNode* heads[] = { doublyLinkedList->head, windowList->head, protectedList->head };
+
+    hashTable->detachAll();
+    doublyLinkedList->detachAll();
+    windowList->detachAll();
+    protectedList->detachAll();
+    binarySearchTree->detachAll();
+    clockHand = nullptr;
+    totalWeight = 0;
+
+    if (priorityHeap != nullptr) {
+        priorityHeap->clear();
+        inflation = 0.0;
+    }
+
+    // The ghosts (and ARC's target) describe keys that are gone; a key added again must not count as a ghost hit
+    if (recencyGhosts != nullptr) {
+        recencyGhosts->clear();
+    }
+    if (frequencyGhosts != nullptr) {
+        frequencyGhosts->clear();
+    }
+    arcTarget = 0;
+
+    timerWheel->clear();
+
+    // Buffered hits are for entries that are gone; a key added again must not inherit them
+    accessBuffer->drain(drainedKeys.data());
+
+    for (DllNode* current : heads) {
+        while (current != nullptr) {
+            DllNode* next = current->next;
+            static_cast<CacheEntry*>(current)->timerBucket = -1;
+            releaseEntry(static_cast<CacheEntry*>(current));
+            current = next;
+        }
+    }
+}
+
+/**
+*
+* getItem
+*
+* Method to retrieve item from the CacheManager
+*
+* @param    curKey  retrieve node from CacheManager with curKey value
+*
+* @return   pointer to the DllNode, or nullptr if it is not cached or its time to live has passed
+*/
+DllNode* CacheManager::getItem(int curKey) {
+    DllNode* fifoNode = hashTable->getItem(curKey);
+    if (fifoNode == nullptr) {
+        return nullptr;
+    }
+
+    // The wheel only removes entries as it is advanced, so check the deadline between its ticks
+    if (isExpired(static_cast<CacheEntry*>(fifoNode))) {
+        remove(curKey);
+        return nullptr;
+    }
+
+    recordHit(fifoNode);
+
+    return fifoNode;
+}
+
+/**
+*
+* getMaxCacheSize
+*
+* Method to retrieve max size of cache from the CacheManager
+*
+* @param    none
+*
+* @return   max size of cache manager
+*/
+int CacheManager::getMaxCacheSize() {
+    return maxCacheSize;
+}
+
+/**
+*
+* getArcTarget
+*
+* Method to retrieve ARC's adaptation target p, the number of entries it currently aims to keep
+* in T1 (seen once); it rises while recency pays off and falls while frequency does
+*
+* @param    none
+*
+* @return   p, from 0 to the max cache size; 0 for other eviction policies
+*/
+int CacheManager::getArcTarget() {
+    return arcTarget;
+}
+
+/**
+*
+* getInflation
+*
+* Method to retrieve the GDSF inflation clock L, the priority of the last victim; new and hit
+* entries start from it, so entries that stop being hit fall behind
+*
+* @param    none
+*
+* @return   L; 0 before the first GDSF eviction and for other eviction policies
+*/
+double CacheManager::getInflation() {
+    return inflation;
+}
+
+/**
+*
+* getWeightedSize
+*
+* Method to retrieve the bytes charged for the cached entries: for each, the entry itself (with
+* its list, hash chain and tree links), its share of the hash index and its weigher bytes
+*
+* @param    none
+*
+* @return   cached bytes
+*/
+size_t CacheManager::getWeightedSize() {
+    return totalWeight;
+}
+
+/**
+*
+* getMaxWeightBytes
+*
+* Method to retrieve the byte budget the cache is evicted down to after each add
+*
+* @param    none
+*
+* @return   the budget, or 0 if the cache is limited by entry count only
+*/
+size_t CacheManager::getMaxWeightBytes() {
+    return maxWeightBytes;
+}
+
+/**
+*
+* expireEntries
+*
+* Method to remove every entry whose time to live has passed; add does this as it goes, and
+* a caller that adds rarely can call it to release expired entries sooner
+*
+* @param    none
+*
+* @return   number of entries removed
+*/
+int CacheManager::expireEntries() {
+    return expireUntil(clock());
+}
+
+/**
+*
+* contains
+*
+* Method to determine if a key value is in the cache; an expired entry is removed and does not count
+*
+* @param    curKey  retrieve node from cacheManager with curKey value
+*
+* @return   true if exists, false otherwise
+*/
+bool CacheManager::contains(int curKey) {
+    DllNode* fifoNode = hashTable->getItem(curKey);
+
+    if (fifoNode == nullptr) {
+        return false;
+    }
+
+    if (isExpired(static_cast<CacheEntry*>(fifoNode))) {
+        remove(curKey);
+        return false;
+    }
+
+    recordHit(fifoNode);
+
+    return true;
+}
+
+/**
+*
+* lookupMany
+*
+* Method to look up count keys without promoting them; each group of keys is prefetched
+* before any of its probes, so their cache misses overlap
+*
+* @param    keys        keys to look up
+* @param    count       number of keys
+* @param    results     set to each key's entry, or nullptr if it is not cached
+*
+* @return   number of keys found
+*/
+int CacheManager::lookupMany(const int* keys, int count, DllNode** results) {
+    int found = 0;
+
+    for (int start = 0; start < count; start += PREFETCH_GROUP_SIZE) {
+        int end = std::min(count, start + PREFETCH_GROUP_SIZE);
+
+        for (int i = start; i < end; i++) {
+            hashTable->prefetch(keys[i]);
+        }
+
+        for (int i = start; i < end; i++) {
+            results[i] = hashTable->getItem(keys[i]);
+            if (results[i] != nullptr && isExpired(static_cast<CacheEntry*>(results[i]))) {
+                remove(keys[i]);
+                results[i] = nullptr;
+            }
+            if (results[i] != nullptr) {
+                found++;
+            }
+        }
+    }
+
+    return found;
+}
+
+/**
+*
+* promoteMany
+*
+* Method to record a hit on every entry found by one batch, in request order, so the
+* cache ends up as if each key had been looked up in turn
+*
+* @param    nodes       lookup results; nullptr entries are skipped
+* @param    count       number of results
+*
+* @return   nothing
+*/
+void CacheManager::promoteMany(DllNode** nodes, int count) {
+    for (int i = 0; i < count; i++) {
+        if (nodes[i] != nullptr) {
+            recordHit(nodes[i]);
+        }
+    }
+}
+
+/**
+*
+* getItems
+*
+* Method to retrieve a batch of items; all keys are looked up first, then every hit is
+* promoted in one pass
+*
+* @param    keys        keys to look up
+* @param    count       number of keys
+* @param    results     array of count pointers, set to each key's DllNode or nullptr
+*
+* @return   number of keys found
+*/
+int CacheManager::getItems(const int* keys, int count, DllNode** results) {
+    int found = lookupMany(keys, count, results);
+
+    promoteMany(results, count);
+
+    return found;
+}
+
+/**
+*
+* containsMany
+*
+* Method to determine which of a batch of keys are in the cache; hits are promoted as in getItems
+*
+* @param    keys        keys to look up
+* @param    count       number of keys
+* @param    results     array of count flags, set to true for each key that is cached
+*
+* @return   number of keys found
+*/
+int CacheManager::containsMany(const int* keys, int count, bool* results) {
+    if ((int)batchNodes.size() < count) {
+        batchNodes.resize(count);
+    }
+
+    int found = lookupMany(keys, count, batchNodes.data());
+
+    for (int i = 0; i < count; i++) {
+        results[i] = (batchNodes[i] != nullptr);
+    }
+
+    promoteMany(batchNodes.data(), count);
+
+    return found;
+}
+
+/**
+*
+* peek
+*
+* Method to retrieve an item without recording a hit; nothing is written, so readers holding
+* a shared lock may call it together, and their hits are applied later through promote
+*
+* @param    curKey  key to look up
+*
+* @return   pointer to the DllNode, or nullptr if it is not cached or its time to live has
+*           passed (an expired entry is left for the next add to remove)
+*/
+DllNode* CacheManager::peek(int curKey) const {
+    DllNode* fifoNode = hashTable->getItem(curKey);
+
+    if (fifoNode == nullptr || isExpired(static_cast<CacheEntry*>(fifoNode))) {
+        return nullptr;
+    }
+
+    return fifoNode;
+}
+
+/**
+*
+* containsNoTouch
+*
+* Method to determine if a key is cached without recording a hit, as peek does
+*
+* @param    curKey  key to look up
+*
+* @return   true if it is cached and not expired, false otherwise
+*/
+bool CacheManager::containsNoTouch(int curKey) const {
+    return peek(curKey) != nullptr;
+}
+
+/**
+*
+* peekMany
+*
+* Method to look up a batch of keys without recording hits, prefetching each group of keys
+* before probing them
+*
+* @param    keys        keys to look up
+* @param    count       number of keys
+* @param    results     array of count pointers, set to each key's DllNode or nullptr
+*
+* @return   number of keys found
+*/
+int CacheManager::peekMany(const int* keys, int count, DllNode** results) const {
+    int found = 0;
+
+    for (int start = 0; start < count; start += PREFETCH_GROUP_SIZE) {
+        int end = std::min(count, start + PREFETCH_GROUP_SIZE);
+
+        for (int i = start; i < end; i++) {
+            hashTable->prefetch(keys[i]);
+        }
+
+        for (int i = start; i < end; i++) {
+            results[i] = peek(keys[i]);
+            if (results[i] != nullptr) {
+                found++;
+            }
+        }
+    }
+
+    return found;
+}
+
+/**
+*
+* promote
+*
+* Method to record the hits peek and peekMany left out: each key that is still cached counts
+* as one hit, in order, as if getItem had been called for it; keys evicted in the meantime
+* are skipped. Takes the writer's side of any lock the caller uses.
+*
+* @param    keys        keys that were hit
+* @param    count       number of keys
+*
+* @return   number of keys promoted
+*/
+int CacheManager::promote(const int* keys, int count) {
+    if ((int)batchNodes.size() < count) {
+        batchNodes.resize(count);
+    }
+
+    // Looked up again rather than passed in: an entry peeked earlier may have been evicted since
+    int found = lookupMany(keys, count, batchNodes.data());
+
+    promoteMany(batchNodes.data(), count);
+
+    return found;
+}
+
+/**
+*
+* getItemDeferred
+*
+* Method to retrieve an item and record the hit in the calling thread's access buffer instead
+* of applying it; like peek it changes no cache structure, so readers holding a shared lock
+* may call it together. The hits are applied by the next drainHits or add, and a hit is
+* dropped if its buffer is full, so recency is approximate.
+*
+* @param    curKey  key to look up
+*
+* @return   pointer to the DllNode, or nullptr if it is not cached or has expired
+*/
+DllNode* CacheManager::getItemDeferred(int curKey) {
+    DllNode* fifoNode = peek(curKey);
+
+    if (fifoNode != nullptr) {
+        accessBuffer->record(curKey);
+    }
+
+    return fifoNode;
+}
+
+/**
+*
+* isDrainDue
+*
+* Method to check if an access buffer has filled, so that the caller should take the writer's
+* lock (a try-lock is enough; another thread may be draining already) and call drainHits
+*
+* @param    none
+*
+* @return   true if hits are waiting and some are being dropped
+*/
+bool CacheManager::isDrainDue() const {
+    return accessBuffer->isDrainDue();
+}
+
+/**
+*
+* drainHits
+*
+* Method to apply every hit recorded by getItemDeferred, as promote does; takes the writer's
+* side of any lock the caller uses
+*
+* @param    none
+*
+* @return   number of hits applied
+*/
+int CacheManager::drainHits() {
+    int count = accessBuffer->drain(drainedKeys.data());
+
+    return (count > 0) ? promote(drainedKeys.data(), count) : 0;
+}
+
+/**
+*
+* evictTo
+*
+* Method to apply any buffered hits, then evict entries in policy order until at most
+* targetSize remain or maxVictims have been evicted; the background evictor calls it under
+* evictionLock, and a caller may use it to trim the cache itself
+*
+* @param    targetSize  number of entries to keep
+* @param    maxVictims  most entries to evict in this call
+*
+* @return   number of entries evicted
+*/
+int CacheManager::evictTo(int targetSize, int maxVictims) {
+    if (accessBuffer->hasPending()) {
+        drainHits();
+    }
+
+    int evicted = 0;
+
+    while (evicted < maxVictims && getSize() > std::max(targetSize, 0)) {
+        evictVictim();
+        evicted++;
+    }
+
+    return evicted;
+}
+
+/**
+*
+* runEvictor
+*
+* Method run by the background evictor thread: waits until add reports the cache past
+* highWatermark, then evicts down to lowWatermark in batches, taking evictionLock for
+* each batch so foreground calls get in between; returns once the destructor stops it
+*
+* @param    none
+*
+* @return   nothing
+*/
+void CacheManager::runEvictor() {
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> guard(evictorMutex);
+            evictorWake.wait(guard, [this] { return evictorStop || evictionRequested.load(); });
+            if (evictorStop) {
+                return;
+            }
+        }
+
+        // Cleared before the pass, so an add that crosses highWatermark during it asks for another
+        evictionRequested = false;
+
+        int evicted;
+        do {
+            std::unique_lock<std::shared_mutex> cacheLock(*evictionLock);
+            evicted = evictTo(lowWatermark, BACKGROUND_EVICTION_BATCH);
+        } while (evicted == BACKGROUND_EVICTION_BATCH);
+    }
+}
+
+/**
+*
+* requestEviction
+*
+* Method to wake the background evictor, unless a wake-up is already pending
+*
+* @param    none
+*
+* @return   nothing
+*/
+void CacheManager::requestEviction() {
+    if (evictionRequested.exchange(true)) {
+        return;
+    }
+
+    // Taking the mutex orders the flag before the evictor's check, so the notify cannot fall between its check and its wait
+    {
+        std::lock_guard<std::mutex> guard(evictorMutex);
+    }
+    evictorWake.notify_one();
+}
+
+/**
+*
+* addMany
+*
+* Method to add a batch of entries, prefetching each group of keys before adding them in order;
+* the result is the same as calling add for each key in turn. A batch in strictly ascending key
+* order that an empty cache holds whole (with no maxWeightBytes budget) evicts nothing, so the
+* ordered index is built from it in one linear pass instead of key by key.
+*
+* @param    keys        keys to add
+* @param    entries     entries for the keys, allocated with new; the CacheManager takes ownership
+* @param    count       number of keys
+*
+* @return   number of entries added
+*/
+int CacheManager::addMany(const int* keys, CacheEntry* const* entries, int count) {
+    int added = 0;
+
+    // Nothing is evicted or updated while a bulk load runs, so every entry of the batch ends up cached
+    bool bulkLoad = count > 1 && isEmpty() && count <= maxCacheSize && maxWeightBytes == 0;
+    for (int i = 1; bulkLoad && i < count; i++) {
+        bulkLoad = keys[i - 1] < keys[i];
+    }
+    deferTreeAttach = bulkLoad;
+
+    for (int start = 0; start < count; start += PREFETCH_GROUP_SIZE) {
+        int end = std::min(count, start + PREFETCH_GROUP_SIZE);
+
+        for (int i = start; i < end; i++) {
+            hashTable->prefetch(keys[i]);
+        }
+
+        for (int i = start; i < end; i++) {
+            if (add(keys[i], entries[i])) {
+                added++;
+            }
+        }
+    }
+
+    if (bulkLoad) {
+        deferTreeAttach = false;
+        binarySearchTree->attachSorted(entries, count);
+    }
+
+    return added;
+}
+
+/**
+*
+* printCache
+*
+* Method to print out the cache information
+*
+* @param    none
+*
+* @return   nothing, but prints out the cache information
+*/
+void CacheManager::printCache() {
+    std::ofstream& outFile = getOutFile();
+
+    std::cout << "Printing out the cache: " << std::endl;
+    outFile << "Printing out the cache: " << std::endl;
+
+    std::cout << "Here are the FIFO List contents: " << std::endl;
+    outFile << "Here are the FIFO List contents: " << std::endl;
+
+    if (isEmpty()) {
+        std::cout << "Empty list" << std::endl;
+        outFile << "Empty list" << std::endl;
+    } else {
+        // W-TinyLFU lists print newest first: window, protected, then probation (next to be evicted)
+        DllNode* heads[] = { windowList->head, protectedList->head, doublyLinkedList->head };
+
+        for (DllNode* current : heads) {
+            while (current != nullptr) {
+                std::cout << current->key << " " << std::endl;
+                outFile << current->key << " " << std::endl;
+                current = current->next;
+            }
+        }
+    }
+
+    std::cout << "End of FIFO List" << std::endl;
+    outFile << "End of FIFO List" << std::endl;
+
+    hashTable->printTable();
+}
+
+/**
+*
+* printRange
+*
+* Method to traverse and print out the cache information given a low and high value.
+*
+* @param    low    the lower bound (inclusive) of the range to print
+* @param    high   the higher bound (inclusive) of the range to print
+*
+* @return   nothing, but prints out the keys for the cache between low and high
+*/
+void CacheManager::printRange(int low, int high) {
+    binarySearchTree->printRange(low, high);
+}
+
+/**
+*
+* rank
+*
+* Method to count the cached keys smaller than key, in one descent of the ordered index;
+* entries past their ttl are counted until they are removed (see expireEntries)
+*
+* @param    key     key to rank; it need not be cached
+*
+* @return   number of cached keys < key, which is key's 0-based position if it is cached
+*/
+int CacheManager::rank(int key) const {
+    return binarySearchTree->rank(key);
+}
+
+/**
+*
+* select
+*
+* Method to find the cached key at a 0-based position in ascending order, in one descent;
+* like peek it records no hit
+*
+* @param    index   position, 0 for the smallest key
+*
+* @return   that key's FIFO node, or nullptr if index is not in [0, getSize())
+*/
+DllNode* CacheManager::select(int index) const {
+    return binarySearchTree->select(index);
+}
+
+/**
+*
+* countInRange
+*
+* Method to count the cached keys in [low, high] without visiting them
+*
+* @param    low     the lower bound (inclusive)
+* @param    high    the higher bound (inclusive)
+*
+* @return   number of cached keys in the range; 0 if low > high
+*/
+int CacheManager::countInRange(int low, int high) const {
+    return binarySearchTree->countInRange(low, high);
+}
+
+/**
+*
+* percentile
+*
+* Method to find the nearest-rank percentile key: the smallest cached key with at least
+* percent% of the cached keys at or below it; like peek it records no hit
+*
+* @param    percent     percentile, clamped to [0, 100]; 0 gives the smallest key, 100 the largest
+*
+* @return   that key's FIFO node, or nullptr if the cache is empty
+*/
+DllNode* CacheManager::percentile(double percent) const {
+    return binarySearchTree->percentile(percent);
+}
+
+/**
+*
+* openRange
+*
+* Method to open a cursor on the cached keys in [low, high]; it reads the ordered index a
+* step at a time, records no hits, and is invalidated by any add, remove or eviction
+*
+* @param    low         the lower bound (inclusive)
+* @param    high        the higher bound (inclusive)
+* @param    ascending   true to visit the keys from low to high, false from high to low
+*
+* @return   a cursor on the first key in that direction; invalid if the range is empty
+*/
+RangeCursor CacheManager::openRange(int low, int high, bool ascending) const {
+    return binarySearchTree->openRange(low, high, ascending);
+}
+
+/**
+*
+* sort
+*
+* Method to print out the cache information in sorted order
+*
+* @param    ascending   true, if output is to be in ascending order, false for descending order
+*
+* @return   nothing, but prints out the keys for the cache in sorted order
+*/
+void CacheManager::sort(bool ascending) {
+    if (ascending) {
+        binarySearchTree->printInOrder();
+    } else {
+        binarySearchTree->printReverseOrder();
+    }
+
+    binarySearchTree->printBreadthFirst();
 }
\ No newline at end of file
@@ -1,216 +1,1095 @@
-/**
-*
-* cache_manager.h : This is the header file for cache_manager.cpp.
-*
-* 09/23/24 - Created by ChatGPT
-* 10/17/24 - Modified by jhui
-* 01/11/25 - Modified by hhui; 1) added calculateHashCode, 2) modified methods to include hash table size parameter
-* 01/16/2025 - Modified by hhui; created separate node structure file
-* 01/27/2025 - Modified by hhui; added getMaxCacheSize
-* 05/17/2025 - Modified by Adrian Aquino; changed to use SelfBalancingTree instead of BinarySearchTree for Milestone 6
-* 05/21/2025 - Modified by Adrian Aquino; updated for updated red-black tree implementation
-*/
-
-#ifndef _CACHE_MANAGER
-#define _CACHE_MANAGER
-
-#include "hash_table.h"
-#include "doubly_linked_list.h"
-#include "self_balancing_tree.h"
-
-class CacheManager {
-private:
-	HashTable* hashTable;
-	DoublyLinkedList* doublyLinkedList;
-	SelfBalancingTree* binarySearchTree;
-
-	int maxCacheSize;
-
-public:
-	CacheManager(int myMaxCacheSize, int myHashTableSize) {
-		if (myHashTableSize > myMaxCacheSize) {
-			myMaxCacheSize = myHashTableSize;
-			std::cout << "Resetting MaxCacheSize, " << myMaxCacheSize << ", to match myHashTableSize of : " << myHashTableSize << "!  Reconsider your life choices!!!" << std::endl;
-
-		}
-
-		hashTable = new HashTable(myHashTableSize);
-		doublyLinkedList = new DoublyLinkedList();
-		binarySearchTree = new SelfBalancingTree();
-
-		maxCacheSize = myHashTableSize;
-	}
-
-	/**
-	*
-	* getTable
-	*
-	* Method to return the hash table
-	*
-	* @param    none
-	*
-	* @return	the hash table
-	*/
-	HashTable* getTable();
-
-	/**
-	*
-	* getList
-	*
-	* Method to return the FIFO list
-	*
-	* @param    none
-	*
-	* @return	the FIFO list
-	*/
-	DoublyLinkedList* getList();
-
-	/**
-	*
-	* getBst
-	*
-	* Method to return the BST
-	*
-	* @param    none
-	*
-	* @return	the BST
-	*/
-	SelfBalancingTree* getBst();
-
-	/**
-	*
-	* getSize
-	*
-	* Method to return the number of items in the CacheManager
-	*
-	* @param    none
-	*
-	* @return	number of items in the CacheManager
-	*/
-	int getSize();
-
-	/**
-	*
-	* isEmpty
-	*
-	* Method to check if CacheManager is empty
-	*
-	* @param    none
-	*
-	* @return   true if the CacheManager has zero entries, false otherwise
-	*/
-	bool isEmpty();
-
-	/**
-	*
-	* add
-	*
-	* Method to add a node to the CacheManager
-	*
-	* @param    curKey    key for this node
-	* @param    myNode    new node to add to the table
-	*
-	* @return   true if success, false otherwise
-	*/
-	bool add(int curKey, DllNode* myNode);
-
-	/**
-	*
-	* remove
-	*
-	* Method to remove node with curKey
-	*
-	* @param    key     key of node to remove
-	*
-	* @return   true if success, false otherwise
-	*/
-	bool remove(int curKey);
-
-	/**
-	*
-	* clear
-	*
-	* Method to remove all entries from the CacheManager
-	*
-	* @param    none
-	*
-	* @return   nothing, but will delete all entries from the CacheManager
-	*/
-	void clear();
-
-	/**
-	*
-	* getItem
-	*
-	* Method to retrieve item from the CacheManager
-	*
-	* @param    curKey  retrieve node from CacheManager with curKey value
-	*
-	* @return   pointer to the DllNode
-	*/
-	DllNode* getItem(int curKey);
-
-	/**
-	*
-	* getMaxCacheSize
-	*
-	* Method to retrieve max size of cache from the CacheManager
-	*
-	* @param    none
-	*
-	* @return   max size of cache manager
-	*/
-	int getMaxCacheSize();
-
-	/**
-	*
-	* contains
-	*
-	* Method to determine if a key value is in the cache
-	*
-	* @param    curKey  retrieve node from cacheManager with curKey value
-	*
-	* @return   true if exists, false otherwise
-	*/
-	bool contains(int curKey);
-
-	/**
-	*
-	* printCache
-	*
-	* Method to print out the cache information
-	*
-	* @param    none
-	*
-	* @return   nothing, but prints out the cache information
-	*/
-	void printCache();
-
-	/**
-	*
-	* range
-	*
-	* Method to traverse and print out the cache information given a low and high value.
-	*
-	* @param    low			the lower bound (inclusive) of the range to print
-	* @param	high		the higher bound (inclusive) of the range to print
-	*
-	* @return   nothing, but prints out the keys for the cache between low and high
-	*/
-	void printRange(int low, int high);
-
-	/**
-	*
-	* sort
-	*
-	* Method to print out the cache information in sorted order
-	*
-	* @param    ascending	true, if output is to be in ascending order, false for descending order
-	*
-	* @return   nothing, but prints out the keys for the cache in sorted order
-	*/
-	void sort(bool ascending);
-
-};
-
+/**
+*
+* cache_manager.h : This is the header file for cache_manager.cpp.
+*
+* 09/23/24 - Created by ChatGPT
+* 10/17/24 - Modified by jhui
+* 01/11/25 - Modified by hhui; 1) added calculateHashCode, 2) modified methods to include hash table size parameter
+* 01/16/2025 - Modified by hhui; created separate node structure file
+* 01/27/2025 - Modified by hhui; added getMaxCacheSize
+* 05/17/2025 - Modified by Adrian Aquino; changed to use SelfBalancingTree instead of BinarySearchTree for Milestone 6
+* 05/21/2025 - Modified by Adrian Aquino; updated for updated red-black tree implementation
+* 10/18/26 - hash table is now a HashIndex; the engine is picked through CacheOptions
+* 10/18/26 - added the SWISS_TABLE engine
+* 10/18/26 - the CHAINED engine is instantiated with the configured hash policy
+* 10/18/26 - add updates an existing key in place, probing each structure once
+* 10/18/26 - entries are single-allocation CacheEntry objects owned by the CacheManager; added destructor
+* 10/18/26 - added the preallocateEntries mode and add(curKey, payload), which recycles evicted entries
+* 10/18/26 - entries, bucket arrays and tree nodes come from options.memoryResource when one is given
+* 10/18/26 - added getItems, containsMany and addMany, which prefetch a batch of keys before probing
+* 10/18/26 - added the CLOCK_EVICTION policy; hits go through recordHit
+* 10/18/26 - added the TINY_LFU_EVICTION policy with its window and protected lists and frequency sketch
+* 10/18/26 - added the ARC_EVICTION policy with its ghost lists, and getArcTarget
+* 10/18/26 - added the S3_FIFO_EVICTION policy
+* 10/18/26 - added the GDSF_EVICTION policy; add takes an optional per-entry cost
+* 10/18/26 - added byte-weighted capacity (maxWeightBytes), getWeightedSize and getMaxWeightBytes
+* 10/18/26 - added per-entry time to live: add overloads taking a ttl, a TimerWheel, and expireEntries
+* 10/18/26 - added the const read path (peek, containsNoTouch, peekMany) and promote for batched hits
+* 10/18/26 - added getItemDeferred, which records hits in an AccessBuffer, and isDrainDue/drainHits
+* 10/18/26 - added background eviction between watermarks under options.evictionLock, and evictTo
+* 10/18/26 - the tree is an OrderedIndex; the B_PLUS_TREE engine is picked through CacheOptions
+* 10/18/26 - added the order statistics rank, select, countInRange and percentile
+* 10/18/26 - added openRange and forEachInRange, which read a key range without printing it
+* 10/18/26 - addMany builds the ordered index in one pass when a sorted batch fills an empty cache
+* 10/18/26 - added getInflation
+*/
+
+#ifndef _CACHE_MANAGER
+#define _CACHE_MANAGER
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+#include "hash_table.h"
+#include "flat_hash_table.h"
+#include "swiss_hash_table.h"
+#include "cache_options.h"
+#include "cache_entry.h"
+#include "doubly_linked_list.h"
+#include "self_balancing_tree.h"
+#include "bplus_tree.h"
+#include "frequency_sketch.h"
+#include "ghost_list.h"
+#include "entry_heap.h"
+#include "timer_wheel.h"
+#include "access_buffer.h"
+
+class CacheManager {
+private:
+	HashIndex* hashTable;
+	DoublyLinkedList* doublyLinkedList;
+	OrderedIndex* binarySearchTree;	// red-black tree or B+tree, by options.orderedIndex
+
+	int maxCacheSize;
+
+	CacheEntry* entryPool;			// entries allocated up front when preallocateEntries is set, nullptr otherwise
+	int entryPoolSize;
+	CacheEntry* freeEntries;		// unused entries, linked through DllNode::next
+
+	std::pmr::memory_resource* memoryResource;	// source of entries (and of the structures' storage); nullptr = new/delete
+
+	std::vector<DllNode*> batchNodes;	// containsMany's lookup results, kept to avoid reallocating per batch
+
+	EvictionPolicy evictionPolicy;
+	DllNode* clockHand;				// next entry the CLOCK hand examines; nullptr = start at the tail
+
+	DoublyLinkedList* windowList;		// W-TinyLFU admission window or S3-FIFO small queue (WINDOW_SEGMENT); empty for other policies
+	DoublyLinkedList* protectedList;	// W-TinyLFU entries hit again in probation (PROTECTED_SEGMENT)
+	FrequencySketch* frequencySketch;	// W-TinyLFU access counts; nullptr for other policies
+	int windowCapacity;
+	int protectedCapacity;
+
+	GhostList* recencyGhosts;		// ARC B1 (keys recently evicted from T1) or the S3-FIFO ghost queue; nullptr for other policies
+	GhostList* frequencyGhosts;		// ARC B2: keys recently evicted from T2
+	int arcTarget;					// ARC p: the size T1 is steered toward
+
+	EntryHeap* priorityHeap;		// GDSF entries by priority; nullptr for other policies
+	double inflation;				// GDSF clock L: the priority of the last victim
+
+	size_t maxWeightBytes;			// byte budget; 0 = the cache is limited by entry count only
+	EntryWeigher weigher;			// payload bytes charged per entry
+	size_t entryOverhead;			// bytes charged per entry besides its payload: the entry and its index share
+	size_t totalWeight;				// sum of the cached entries' weights
+
+	TimerWheel* timerWheel;			// entries added with a ttl, by deadline
+	CacheClock clock;				// time source for deadlines, in milliseconds
+
+	AccessBuffer* accessBuffer;		// hits recorded by getItemDeferred, not yet applied
+	std::vector<int> drainedKeys;	// drainHits' copy of the buffer, sized to its capacity
+
+	std::shared_mutex* evictionLock;	// caller's lock the background evictor takes; nullptr = add evicts alone
+	int highWatermark;				// entry count above which add wakes the evictor
+	int lowWatermark;				// entry count the evictor brings the cache down to
+	std::thread evictorThread;
+	std::mutex evictorMutex;		// guards evictorStop and the evictor's wait
+	std::condition_variable evictorWake;
+	bool evictorStop;
+	std::atomic<bool> evictionRequested;	// set by add past highWatermark, cleared when the evictor starts a pass
+
+	bool deferTreeAttach;			// set while addMany bulk loads: add leaves the ordered index to attachSorted
+
+	/**
+	*
+	* listOf
+	*
+	* Method to return the list an entry is linked on
+	*
+	* @param    entry    a cached entry
+	*
+	* @return   doublyLinkedList, windowList or protectedList, by the entry's segment
+	*/
+	DoublyLinkedList* listOf(CacheEntry* entry);
+
+	/**
+	*
+	* recordTinyLfuHit
+	*
+	* Method to count a hit in the sketch and promote the entry: within the window, from probation
+	* to protected, or within protected; a protected list over capacity demotes its tail to probation
+	*
+	* @param    entry    the entry that was hit
+	*
+	* @return   nothing
+	*/
+	void recordTinyLfuHit(CacheEntry* entry);
+
+	/**
+	*
+	* admitFromWindow
+	*
+	* Method to move the window's oldest entry into probation once the window is over capacity and,
+	* if the cache is then over capacity, evict whichever of that candidate and the main victim
+	* (probation tail, else protected tail) the sketch has seen less often
+	*
+	* @param    none
+	*
+	* @return   nothing
+	*/
+	void admitFromWindow();
+
+	/**
+	*
+	* linkArcEntry
+	*
+	* Method to put a new entry in ARC: a key found in B1 or B2 first moves p, then goes to T2;
+	* any other key goes to T1 after the ghost lists are trimmed; a full cache evicts through
+	* replaceArcEntry before the entry is linked
+	*
+	* @param    entry    the new entry, already in the hash table but not yet on a list
+	*
+	* @return   nothing
+	*/
+	void linkArcEntry(CacheEntry* entry);
+
+	/**
+	*
+	* replaceArcEntry
+	*
+	* Method to evict the LRU entry of T1 into B1 if T1 is larger than p (or equal to it and the
+	* new key came from B2), otherwise the LRU entry of T2 into B2
+	*
+	* @param    fromFrequencyGhosts     true if the key being added was found in B2
+	*
+	* @return   nothing
+	*/
+	void replaceArcEntry(bool fromFrequencyGhosts);
+
+	/**
+	*
+	* linkS3FifoEntry
+	*
+	* Method to put a new entry in S3-FIFO: a full cache first evicts one entry, then the entry
+	* goes to the main queue if its key is in the ghost queue and to the small queue otherwise
+	*
+	* @param    entry    the new entry, already in the hash table but not yet on a list
+	*
+	* @return   nothing
+	*/
+	void linkS3FifoEntry(CacheEntry* entry);
+
+	/**
+	*
+	* evictS3FifoEntry
+	*
+	* Method to evict one entry: from the small queue while it is at its share of the cache, where
+	* an entry that was hit moves to main instead and one that was not leaves for the ghost queue;
+	* otherwise from main, which reinserts an entry that was hit and spends one of its accesses
+	*
+	* @param    none
+	*
+	* @return   nothing
+	*/
+	void evictS3FifoEntry();
+
+	/**
+	*
+	* linkGdsfEntry
+	*
+	* Method to put a new entry in the GDSF heap with one access; a full cache first evicts the
+	* lowest-priority entry and raises the inflation clock to its priority
+	*
+	* @param    entry    the new entry, already in the hash table but not yet on a list
+	*
+	* @return   nothing
+	*/
+	void linkGdsfEntry(CacheEntry* entry);
+
+	/**
+	*
+	* refreshGdsfPriority
+	*
+	* Method to recompute an entry's GDSF priority from the current clock, its access count,
+	* cost and size, and move it to its place in the heap
+	*
+	* @param    entry    an entry in the heap
+	*
+	* @return   nothing
+	*/
+	void refreshGdsfPriority(CacheEntry* entry);
+
+	/**
+	*
+	* chargeEntry
+	*
+	* Method to weigh an entry (overhead plus weigher bytes) and add it to the total, replacing
+	* the weight it was last charged if it is already cached
+	*
+	* @param    entry    the entry, new or with a changed payload
+	*
+	* @return   nothing
+	*/
+	void chargeEntry(CacheEntry* entry);
+
+	/**
+	*
+	* evictVictim
+	*
+	* Method to evict one entry, the one the eviction policy would pick to make room for an add
+	*
+	* @param    none
+	*
+	* @return   nothing; the cache must not be empty
+	*/
+	void evictVictim();
+
+	/**
+	*
+	* evictToWeightBudget
+	*
+	* Method to evict entries in policy order until the cached bytes are within maxWeightBytes;
+	* does nothing when the cache is limited by entry count only
+	*
+	* @param    none
+	*
+	* @return   nothing
+	*/
+	void evictToWeightBudget();
+
+	/**
+	*
+	* setExpiration
+	*
+	* Method to give a cached entry a new deadline, scheduling it on the timer wheel, or to take
+	* its deadline away
+	*
+	* @param    entry        a cached entry
+	* @param    expiresAt    deadline in clock milliseconds, or 0 for none
+	*
+	* @return   nothing
+	*/
+	void setExpiration(CacheEntry* entry, long long expiresAt);
+
+	/**
+	*
+	* isExpired
+	*
+	* Method to check if an entry's deadline has passed; the clock is only read for entries that have one
+	*
+	* @param    entry    a cached entry
+	*
+	* @return   true if the entry must not be served, false otherwise
+	*/
+	bool isExpired(const CacheEntry* entry) const;
+
+	/**
+	*
+	* expireUntil
+	*
+	* Method to advance the timer wheel to now and remove every entry it reports as due
+	*
+	* @param    now     current clock time in milliseconds
+	*
+	* @return   number of entries removed
+	*/
+	int expireUntil(long long now);
+
+	/**
+	*
+	* recordHit
+	*
+	* Method to note that an entry was used: LRU moves it to the head of the list, CLOCK only
+	* sets its reference bit, so a hit on an entry whose bit is already set writes nothing
+	*
+	* @param    fifoNode    the entry that was hit
+	*
+	* @return   nothing
+	*/
+	void recordHit(DllNode* fifoNode);
+
+	/**
+	*
+	* linkClockEntry
+	*
+	* Method to put a new entry on the CLOCK ring just behind the hand, so the hand reaches it
+	* last; a full cache first evicts a victim, so the new entry is never the one chosen
+	*
+	* @param    entry    the new entry, already in the hash table but not yet on the list
+	*
+	* @return   nothing
+	*/
+	void linkClockEntry(CacheEntry* entry);
+
+	/**
+	*
+	* evictClockVictim
+	*
+	* Method to sweep the hand from tail toward head, wrapping around, clearing reference bits
+	* until it finds an entry whose bit is clear, and remove that entry
+	*
+	* @param    none
+	*
+	* @return   nothing
+	*/
+	void evictClockVictim();
+
+	/**
+	*
+	* lookupMany
+	*
+	* Method to look up count keys without promoting them; each group of keys is prefetched
+	* before any of its probes, so their cache misses overlap
+	*
+	* @param    keys        keys to look up
+	* @param    count       number of keys
+	* @param    results     set to each key's entry, or nullptr if it is not cached
+	*
+	* @return   number of keys found
+	*/
+	int lookupMany(const int* keys, int count, DllNode** results);
+
+	/**
+	*
+	* promoteMany
+	*
+	* Method to record a hit on every entry found by one batch, in request order, so the
+	* cache ends up as if each key had been looked up in turn
+	*
+	* @param    nodes       lookup results; nullptr entries are skipped
+	* @param    count       number of results
+	*
+	* @return   nothing
+	*/
+	void promoteMany(DllNode** nodes, int count);
+
+	/**
+	*
+	* preallocate
+	*
+	* Method to allocate entryCount entries in one block and put them all on the free list
+	*
+	* @param    entryCount    number of entries to allocate
+	*
+	* @return   nothing
+	*/
+	void preallocate(int entryCount);
+
+	/**
+	*
+	* acquireEntry
+	*
+	* Method to take an entry from the free list, or allocate one from memoryResource if the list is empty
+	*
+	* @param    none
+	*
+	* @return   an entry that is not linked into any structure
+	*/
+	CacheEntry* acquireEntry();
+
+	/**
+	*
+	* releaseEntry
+	*
+	* Method to return an entry that has been detached from every structure; preallocated entries go
+	* back on the free list, the rest are freed the way their allocation field says
+	*
+	* @param    entry    the entry to release
+	*
+	* @return   nothing
+	*/
+	void releaseEntry(CacheEntry* entry);
+
+	/**
+	*
+	* runEvictor
+	*
+	* Method run by the background evictor thread: waits until add reports the cache past
+	* highWatermark, then evicts down to lowWatermark in batches, taking evictionLock for
+	* each batch so foreground calls get in between; returns once the destructor stops it
+	*
+	* @param    none
+	*
+	* @return   nothing
+	*/
+	void runEvictor();
+
+	/**
+	*
+	* requestEviction
+	*
+	* Method to wake the background evictor, unless a wake-up is already pending
+	*
+	* @param    none
+	*
+	* @return   nothing
+	*/
+	void requestEviction();
+
+public:
+	CacheManager(int myMaxCacheSize, int myHashTableSize, const CacheOptions& options = CacheOptions()) {
+		if (myHashTableSize > myMaxCacheSize) {
+			myMaxCacheSize = myHashTableSize;
+			std::cout << "Resetting MaxCacheSize, " << myMaxCacheSize << ", to match myHashTableSize of : " << myHashTableSize << "!  Reconsider your life choices!!!" << std::endl;
+
+		}
+
+		if (options.hashEngine == OPEN_ADDRESSING) {
+			hashTable = new FlatHashTable(myHashTableSize, options.memoryResource);
+		} else if (options.hashEngine == SWISS_TABLE) {
+			hashTable = new SwissHashTable(myHashTableSize, options.memoryResource);
+		} else if (options.hashPolicy == FIBONACCI_HASH) {
+			hashTable = new BasicHashTable<FibonacciHash>(myHashTableSize, options.memoryResource);
+		} else if (options.hashPolicy == FAST_RANGE_HASH) {
+			hashTable = new BasicHashTable<FastRangeHash>(myHashTableSize, options.memoryResource);
+		} else if (options.hashPolicy == POWER_OF_TWO_MASK_HASH) {
+			hashTable = new BasicHashTable<PowerOfTwoMaskHash>(myHashTableSize, options.memoryResource);
+		} else {
+			hashTable = new HashTable(myHashTableSize, options.memoryResource);
+		}
+		doublyLinkedList = new DoublyLinkedList();
+		if (options.orderedIndex == B_PLUS_TREE) {
+			binarySearchTree = new BPlusTree(options.memoryResource);
+		} else {
+			binarySearchTree = new SelfBalancingTree(options.memoryResource);
+		}
+
+		maxCacheSize = myHashTableSize;
+
+		entryPool = nullptr;
+		entryPoolSize = 0;
+		freeEntries = nullptr;
+		memoryResource = options.memoryResource;
+
+		evictionPolicy = options.evictionPolicy;
+		clockHand = nullptr;
+
+		// W-TinyLFU: 1% of the cache is the window, 80% of the rest is protected; S3-FIFO: 10% is the small queue
+		windowList = new DoublyLinkedList();
+		protectedList = new DoublyLinkedList();
+		windowCapacity = std::max(1, maxCacheSize / ((evictionPolicy == S3_FIFO_EVICTION) ? 10 : 100));
+		protectedCapacity = (maxCacheSize - windowCapacity) * 8 / 10;
+		frequencySketch = (evictionPolicy == TINY_LFU_EVICTION) ? new FrequencySketch(maxCacheSize, options.memoryResource) : nullptr;
+
+		recencyGhosts = (evictionPolicy == ARC_EVICTION || evictionPolicy == S3_FIFO_EVICTION) ? new GhostList(maxCacheSize, options.memoryResource) : nullptr;
+		frequencyGhosts = (evictionPolicy == ARC_EVICTION) ? new GhostList(maxCacheSize, options.memoryResource) : nullptr;
+		arcTarget = 0;
+
+		// Every entry is in the heap, so it never holds more than a full cache plus the one being added
+		priorityHeap = (evictionPolicy == GDSF_EVICTION) ? new EntryHeap(maxCacheSize + 1, options.memoryResource) : nullptr;
+		inflation = 0.0;
+
+		// The entry holds its list, hash chain and tree links, so its size covers all three structures' nodes
+		maxWeightBytes = options.maxWeightBytes;
+		weigher = (options.weigher != nullptr) ? options.weigher : payloadBytes;
+		entryOverhead = sizeof(CacheEntry) + hashTable->getBytesPerItem();
+		totalWeight = 0;
+
+		clock = (options.clock != nullptr) ? options.clock : steadyClockMilliseconds;
+		timerWheel = new TimerWheel(clock(), options.memoryResource);
+
+		accessBuffer = new AccessBuffer(options.accessBufferStripes, options.memoryResource);
+		drainedKeys.resize(accessBuffer->getCapacity());
+
+		// One spare entry on top of a full cache: add fills it, links it, then evicts the tail into its place
+		if (options.preallocateEntries) {
+			preallocate(maxCacheSize + 1);
+		}
+
+		// The watermarks leave add's own eviction at maxCacheSize as the backstop for an evictor that falls behind
+		evictionLock = options.evictionLock;
+		highWatermark = std::min(maxCacheSize, std::max(1, (int)(maxCacheSize * options.highWatermark)));
+		lowWatermark = std::min(highWatermark, std::max(0, (int)(maxCacheSize * options.lowWatermark)));
+		evictorStop = false;
+		evictionRequested = false;
+		deferTreeAttach = false;
+		if (evictionLock != nullptr) {
+			evictorThread = std::thread(&CacheManager::runEvictor, this);
+		}
+	}
+
+	// Destructor stops the background evictor, if any (the caller must not hold evictionLock),
+	// then deletes every cached entry and the structures
+	~CacheManager();
+
+	/**
+	*
+	* getTable
+	*
+	* Method to return the hash table
+	*
+	* @param    none
+	*
+	* @return	the hash table
+	*/
+	HashIndex* getTable();
+
+	/**
+	*
+	* getList
+	*
+	* Method to return the FIFO list
+	*
+	* @param    none
+	*
+	* @return	the FIFO list
+	*/
+	DoublyLinkedList* getList();
+
+	/**
+	*
+	* getBst
+	*
+	* Method to return the ordered index (a SelfBalancingTree unless options.orderedIndex picked another engine)
+	*
+	* @param    none
+	*
+	* @return	the ordered index
+	*/
+	OrderedIndex* getBst();
+
+	/**
+	*
+	* getSize
+	*
+	* Method to return the number of items in the CacheManager
+	*
+	* @param    none
+	*
+	* @return	number of items in the CacheManager
+	*/
+	int getSize();
+
+	/**
+	*
+	* isEmpty
+	*
+	* Method to check if CacheManager is empty
+	*
+	* @param    none
+	*
+	* @return   true if the CacheManager has zero entries, false otherwise
+	*/
+	bool isEmpty();
+
+	/**
+	*
+	* add
+	*
+	* Method to add an entry to the CacheManager, which takes ownership of it; if curKey is already
+	* cached, the existing entry takes entry's payload and cost and counts as a hit, and entry is released;
+	* with maxWeightBytes set, entries are then evicted in policy order until the cache is within it; an entry
+	* heavier than the whole budget is evicted too, so such an add empties the cache and still returns true
+	*
+	* @param    curKey    key for this entry
+	* @param    entry     new entry, allocated with new; its key is set to curKey
+	* @param    cost      cost of reloading the entry; only GDSF_EVICTION uses it
+	*
+	* @return   true if success, false otherwise
+	*/
+	bool add(int curKey, CacheEntry* entry, double cost = 1.0);
+
+	/**
+	*
+	* add
+	*
+	* Method to add an entry that expires ttl after now; once expired it is no longer returned
+	* by getItem or contains, and the timer wheel removes it on a later add or expireEntries.
+	* Updating a cached key gives it the new deadline.
+	*
+	* @param    curKey    key for this entry
+	* @param    entry     new entry, allocated with new; its key is set to curKey
+	* @param    ttl       time to live; zero or less means the entry does not expire
+	* @param    cost      cost of reloading the entry; only GDSF_EVICTION uses it
+	*
+	* @return   true if success, false otherwise
+	*/
+	bool add(int curKey, CacheEntry* entry, std::chrono::milliseconds ttl, double cost = 1.0);
+
+	/**
+	*
+	* add
+	*
+	* Method to add a plain DllNode; its payload is moved into an entry from acquireEntry and myNode is deleted
+	*
+	* @param    curKey    key for this node
+	* @param    myNode    new node, allocated with new (not a CacheEntry)
+	*
+	* @return   true if success, false otherwise
+	*/
+	bool add(int curKey, DllNode* myNode);
+
+	/**
+	*
+	* add
+	*
+	* Method to add a plain DllNode that expires ttl after now, as add(curKey, myNode) does
+	*
+	* @param    curKey    key for this node
+	* @param    myNode    new node, allocated with new (not a CacheEntry)
+	* @param    ttl       time to live; zero or less means the node does not expire
+	*
+	* @return   true if success, false otherwise
+	*/
+	bool add(int curKey, DllNode* myNode, std::chrono::milliseconds ttl);
+
+	/**
+	*
+	* add
+	*
+	* Method to copy a payload into an entry taken from the free list and add it; with
+	* preallocateEntries set, a full cache adds without allocating or freeing an entry
+	*
+	* @param    curKey      key for this entry
+	* @param    fullName    payload fields copied into the entry
+	* @param    address
+	* @param    city
+	* @param    state
+	* @param    zip
+	* @param    cost        cost of reloading the entry; only GDSF_EVICTION uses it
+	*
+	* @return   true if success, false otherwise
+	*/
+	bool add(int curKey, const std::string& fullName, const std::string& address, const std::string& city, const std::string& state, const std::string& zip, double cost = 1.0);
+
+	/**
+	*
+	* add
+	*
+	* Method to copy a payload into an entry taken from the free list and add it with a time to live
+	*
+	* @param    curKey      key for this entry
+	* @param    fullName    payload fields copied into the entry
+	* @param    address
+	* @param    city
+	* @param    state
+	* @param    zip
+	* @param    ttl         time to live; zero or less means the entry does not expire
+	* @param    cost        cost of reloading the entry; only GDSF_EVICTION uses it
+	*
+	* @return   true if success, false otherwise
+	*/
+	bool add(int curKey, const std::string& fullName, const std::string& address, const std::string& city, const std::string& state, const std::string& zip, std::chrono::milliseconds ttl, double cost = 1.0);
+
+	/**
+	*
+	* remove
+	*
+	* Method to remove node with curKey
+	*
+	* @param    key     key of node to remove
+	*
+	* @return   true if success, false otherwise
+	*/
+	bool remove(int curKey);
+
+	/**
+	*
+	* clear
+	*
+	* Method to remove all entries from the CacheManager
+	*
+	* @param    none
+	*
+	* @return   nothing, but will delete all entries from the CacheManager
+	*/
+	void clear();
+
+	/**
+	*
+	* getItem
+	*
+	* Method to retrieve item from the CacheManager
+	*
+	* @param    curKey  retrieve node from CacheManager with curKey value
+	*
+	* @return   pointer to the DllNode, or nullptr if it is not cached or its time to live has passed
+	*/
+	DllNode* getItem(int curKey);
+
+	/**
+	*
+	* getMaxCacheSize
+	*
+	* Method to retrieve max size of cache from the CacheManager
+	*
+	* @param    none
+	*
+	* @return   max size of cache manager
+	*/
+	int getMaxCacheSize();
+
+	/**
+	*
+	* getArcTarget
+	*
+	* Method to retrieve ARC's adaptation target p, the number of entries it currently aims to keep
+	* in T1 (seen once); it rises while recency pays off and falls while frequency does
+	*
+	* @param    none
+	*
+	* @return   p, from 0 to the max cache size; 0 for other eviction policies
+	*/
+	int getArcTarget();
+
+	/**
+	*
+	* getInflation
+	*
+	* Method to retrieve the GDSF inflation clock L, the priority of the last victim; new and hit
+	* entries start from it, so entries that stop being hit fall behind
+	*
+	* @param    none
+	*
+	* @return   L; 0 before the first GDSF eviction and for other eviction policies
+	*/
+	double getInflation();
+
+	/**
+	*
+	* getWeightedSize
+	*
+	* Method to retrieve the bytes charged for the cached entries: for each, the entry itself (with
+	* its list, hash chain and tree links), its share of the hash index and its weigher bytes
+	*
+	* @param    none
+	*
+	* @return   cached bytes
+	*/
+	size_t getWeightedSize();
+
+	/**
+	*
+	* getMaxWeightBytes
+	*
+	* Method to retrieve the byte budget the cache is evicted down to after each add
+	*
+	* @param    none
+	*
+	* @return   the budget, or 0 if the cache is limited by entry count only
+	*/
+	size_t getMaxWeightBytes();
+
+	/**
+	*
+	* expireEntries
+	*
+	* Method to remove every entry whose time to live has passed; add does this as it goes, and
+	* a caller that adds rarely can call it to release expired entries sooner
+	*
+	* @param    none
+	*
+	* @return   number of entries removed
+	*/
+	int expireEntries();
+
+	/**
+	*
+	* contains
+	*
+	* Method to determine if a key value is in the cache; an expired entry is removed and does not count
+	*
+	* @param    curKey  retrieve node from cacheManager with curKey value
+	*
+	* @return   true if exists, false otherwise
+	*/
+	bool contains(int curKey);
+
+	/**
+	*
+	* getItems
+	*
+	* Method to retrieve a batch of items; all keys are looked up first, then every hit is
+	* promoted in one pass
+	*
+	* @param    keys        keys to look up
+	* @param    count       number of keys
+	* @param    results     array of count pointers, set to each key's DllNode or nullptr
+	*
+	* @return   number of keys found
+	*/
+	int getItems(const int* keys, int count, DllNode** results);
+
+	/**
+	*
+	* containsMany
+	*
+	* Method to determine which of a batch of keys are in the cache; hits are promoted as in getItems
+	*
+	* @param    keys        keys to look up
+	* @param    count       number of keys
+	* @param    results     array of count flags, set to true for each key that is cached
+	*
+	* @return   number of keys found
+	*/
+	int containsMany(const int* keys, int count, bool* results);
+
+	/**
+	*
+	* peek
+	*
+	* Method to retrieve an item without recording a hit; nothing is written, so readers holding
+	* a shared lock may call it together, and their hits are applied later through promote
+	*
+	* @param    curKey  key to look up
+	*
+	* @return   pointer to the DllNode, or nullptr if it is not cached or its time to live has
+	*           passed (an expired entry is left for the next add to remove)
+	*/
+	DllNode* peek(int curKey) const;
+
+	/**
+	*
+	* containsNoTouch
+	*
+	* Method to determine if a key is cached without recording a hit, as peek does
+	*
+	* @param    curKey  key to look up
+	*
+	* @return   true if it is cached and not expired, false otherwise
+	*/
+	bool containsNoTouch(int curKey) const;
+
+	/**
+	*
+	* peekMany
+	*
+	* Method to look up a batch of keys without recording hits, prefetching each group of keys
+	* before probing them
+	*
+	* @param    keys        keys to look up
+	* @param    count       number of keys
+	* @param    results     array of count pointers, set to each key's DllNode or nullptr
+	*
+	* @return   number of keys found
+	*/
+	int peekMany(const int* keys, int count, DllNode** results) const;
+
+	/**
+	*
+	* promote
+	*
+	* Method to record the hits peek and peekMany left out: each key that is still cached counts
+	* as one hit, in order, as if getItem had been called for it; keys evicted in the meantime
+	* are skipped. Takes the writer's side of any lock the caller uses.
+	*
+	* @param    keys        keys that were hit
+	* @param    count       number of keys
+	*
+	* @return   number of keys promoted
+	*/
+	int promote(const int* keys, int count);
+
+	/**
+	*
+	* getItemDeferred
+	*
+	* Method to retrieve an item and record the hit in the calling thread's access buffer instead
+	* of applying it; like peek it changes no cache structure, so readers holding a shared lock
+	* may call it together. The hits are applied by the next drainHits or add, and a hit is
+	* dropped if its buffer is full, so recency is approximate.
+	*
+	* @param    curKey  key to look up
+	*
+	* @return   pointer to the DllNode, or nullptr if it is not cached or has expired
+	*/
+	DllNode* getItemDeferred(int curKey);
+
+	/**
+	*
+	* isDrainDue
+	*
+	* Method to check if an access buffer has filled, so that the caller should take the writer's
+	* lock (a try-lock is enough; another thread may be draining already) and call drainHits
+	*
+	* @param    none
+	*
+	* @return   true if hits are waiting and some are being dropped
+	*/
+	bool isDrainDue() const;
+
+	/**
+	*
+	* drainHits
+	*
+	* Method to apply every hit recorded by getItemDeferred, as promote does; takes the writer's
+	* side of any lock the caller uses
+	*
+	* @param    none
+	*
+	* @return   number of hits applied
+	*/
+	int drainHits();
+
+	/**
+	*
+	* evictTo
+	*
+	* Method to apply any buffered hits, then evict entries in policy order until at most
+	* targetSize remain or maxVictims have been evicted; the background evictor calls it under
+	* evictionLock, and a caller may use it to trim the cache itself
+	*
+	* @param    targetSize  number of entries to keep
+	* @param    maxVictims  most entries to evict in this call
+	*
+	* @return   number of entries evicted
+	*/
+	int evictTo(int targetSize, int maxVictims);
+
+	/**
+	*
+	* addMany
+	*
+	* Method to add a batch of entries, prefetching each group of keys before adding them in order;
+	* the result is the same as calling add for each key in turn. A batch in strictly ascending key
+	* order that an empty cache holds whole (with no maxWeightBytes budget) evicts nothing, so the
+	* ordered index is built from it in one linear pass instead of key by key.
+	*
+	* @param    keys        keys to add
+	* @param    entries     entries for the keys, allocated with new; the CacheManager takes ownership
+	* @param    count       number of keys
+	*
+	* @return   number of entries added
+	*/
+	int addMany(const int* keys, CacheEntry* const* entries, int count);
+
+	/**
+	*
+	* printCache
+	*
+	* Method to print out the cache information
+	*
+	* @param    none
+	*
+	* @return   nothing, but prints out the cache information
+	*/
+	void printCache();
+
+	/**
+	*
+	* range
+	*
+	* Method to traverse and print out the cache information given a low and high value.
+	*
+	* @param    low			the lower bound (inclusive) of the range to print
+	* @param	high		the higher bound (inclusive) of the range to print
+	*
+	* @return   nothing, but prints out the keys for the cache between low and high
+	*/
+	void printRange(int low, int high);
+
+	/**
+	*
+	* rank
+	*
+	* Method to count the cached keys smaller than key, in one descent of the ordered index;
+	* entries past their ttl are counted until they are removed (see expireEntries)
+	*
+	* @param    key     key to rank; it need not be cached
+	*
+	* @return   number of cached keys < key, which is key's 0-based position if it is cached
+	*/
+	int rank(int key) const;
+
+	/**
+	*
+	* select
+	*
+	* Method to find the cached key at a 0-based position in ascending order, in one descent;
+	* like peek it records no hit
+	*
+	* @param    index   position, 0 for the smallest key
+	*
+	* @return   that key's FIFO node, or nullptr if index is not in [0, getSize())
+	*/
+	DllNode* select(int index) const;
+
+	/**
+	*
+	* countInRange
+	*
+	* Method to count the cached keys in [low, high] without visiting them
+	*
+	* @param    low     the lower bound (inclusive)
+	* @param    high    the higher bound (inclusive)
+	*
+	* @return   number of cached keys in the range; 0 if low > high
+	*/
+	int countInRange(int low, int high) const;
+
+	/**
+	*
+	* percentile
+	*
+	* Method to find the nearest-rank percentile key: the smallest cached key with at least
+	* percent% of the cached keys at or below it; like peek it records no hit
+	*
+	* @param    percent     percentile, clamped to [0, 100]; 0 gives the smallest key, 100 the largest
+	*
+	* @return   that key's FIFO node, or nullptr if the cache is empty
+	*/
+	DllNode* percentile(double percent) const;
+
+	/**
+	*
+	* openRange
+	*
+	* Method to open a cursor on the cached keys in [low, high]; it reads the ordered index a
+	* step at a time, records no hits, and is invalidated by any add, remove or eviction
+	*
+	* @param    low         the lower bound (inclusive)
+	* @param    high        the higher bound (inclusive)
+	* @param    ascending   true to visit the keys from low to high, false from high to low
+	*
+	* @return   a cursor on the first key in that direction; invalid if the range is empty
+	*/
+	RangeCursor openRange(int low, int high, bool ascending = true) const;
+
+	/**
+	*
+	* forEachInRange
+	*
+	* Method to call callback(key, fifoNode) for every cached key in [low, high], as printRange
+	* visits them but without printing; the callback must not add or remove entries
+	*
+	* @param    low         the lower bound (inclusive)
+	* @param    high        the higher bound (inclusive)
+	* @param    callback    function or lambda taking (int key, DllNode* fifoNode)
+	* @param    ascending   true to visit the keys from low to high, false from high to low
+	*
+	* @return   number of keys visited
+	*/
+	template <class Callback>
+	int forEachInRange(int low, int high, Callback callback, bool ascending = true) const {
+		return binarySearchTree->forEachInRange(low, high, callback, ascending);
+	}
+
+	/**
+	*
+	* sort
+	*
+	* Method to print out the cache information in sorted order
+	*
+	* @param    ascending	true, if output is to be in ascending order, false for descending order
+	*
+	* @return   nothing, but prints out the keys for the cache in sorted order
+	*/
+	void sort(bool ascending);
+
+};
+
 #endif
\ No newline at end of file
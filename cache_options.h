@@ -0,0 +1,87 @@
+/**
+*
+* cache_options.h : This header file defines the optional settings for CacheManager.
+*
+* 10/18/26 - Created; added hashEngine
+* 10/18/26 - Added hashPolicy
+* 10/18/26 - Added preallocateEntries
+* 10/18/26 - Added memoryResource
+* 10/18/26 - Added evictionPolicy
+* 10/18/26 - Added TINY_LFU_EVICTION
+* 10/18/26 - Added ARC_EVICTION
+* 10/18/26 - Added S3_FIFO_EVICTION
+* 10/18/26 - Added GDSF_EVICTION
+* 10/18/26 - Added maxWeightBytes and weigher
+* 10/18/26 - Added clock
+* 10/18/26 - Added accessBufferStripes
+* 10/18/26 - Added evictionLock, highWatermark and lowWatermark
+* 10/18/26 - Added orderedIndex
+*/
+
+#ifndef _CACHE_OPTIONS
+#define _CACHE_OPTIONS
+
+#include <shared_mutex>
+
+#include "hash_index.h"
+#include "hash_policy.h"
+#include "ordered_index.h"
+#include "memory_resources.h"
+#include "timer_wheel.h"
+
+// How CacheManager picks the entry to evict when an add overflows the cache
+//
+// LRU_EVICTION keeps the list in recency order: every hit moves the entry to the head
+// and the tail is evicted. CLOCK_EVICTION (second chance) treats the list as a ring
+// swept by a hand: a hit only sets the entry's reference bit, and the hand clears set
+// bits as it passes and evicts the first entry whose bit is already clear.
+// TINY_LFU_EVICTION (W-TinyLFU) admits new keys through a small window LRU; an entry
+// leaving the window only displaces the main cache's victim if a frequency sketch
+// says it has been requested more often, so one-hit keys from a scan cannot flush
+// the hot set. The main cache is a segmented LRU (probation and protected).
+// ARC_EVICTION (adaptive replacement) splits the cache into T1, keys seen once
+// recently, and T2, keys seen at least twice, and remembers recently evicted keys
+// of each in ghost lists B1 and B2. A miss that hits B1 means T1 was too small, a
+// miss that hits B2 means T2 was, and the target size p of T1 moves accordingly.
+// S3_FIFO_EVICTION keeps a small FIFO (10% of the cache) that new keys enter, a main
+// FIFO, and a ghost FIFO of keys evicted from the small one. A hit only raises the
+// entry's access count; the count decides, at eviction time, whether an entry leaves
+// the small queue for main or for the ghost queue, and whether main reinserts it.
+// GDSF_EVICTION (GreedyDual-Size-Frequency) evicts the entry with the lowest priority
+// L + accessCount * cost / size, where cost is passed to add, size is the entry's
+// weight in bytes (as charged under maxWeightBytes), and L (the inflation clock) rises
+// to each victim's priority, so entries that are no longer hit age out even if they
+// were once valuable.
+enum EvictionPolicy { LRU_EVICTION = 0, CLOCK_EVICTION = 1, TINY_LFU_EVICTION = 2, ARC_EVICTION = 3, S3_FIFO_EVICTION = 4, GDSF_EVICTION = 5 };
+
+// Optional settings for CacheManager; the defaults reproduce the original behavior
+//
+// maxWeightBytes adds a byte budget to the entry limit: every entry is charged
+// sizeof(CacheEntry), which includes its list, hash chain and tree links, plus its share
+// of the hash index at the maximum load factor, plus weigher(entry), and each add evicts
+// in policy order until the total fits. The entry limit still sizes the index and the
+// policies' segments, so it should be set to the most entries the budget can hold.
+//
+// evictionLock starts a background evictor thread. The caller must hold the lock (shared
+// or exclusive, as it already does) around every CacheManager call. Once an add leaves more
+// than highWatermark * the entry limit cached, the evictor takes the lock exclusively,
+// a batch of victims at a time, until lowWatermark * the limit remain. add still evicts
+// by itself at the entry limit, which only happens if the evictor falls behind.
+struct CacheOptions {
+	HashEngine hashEngine = CHAINED;		// hash table engine used for key lookups
+	HashPolicyKind hashPolicy = MODULO_HASH;	// bucket selection for the CHAINED engine
+	OrderedIndexEngine orderedIndex = RED_BLACK_TREE;	// sorted index used for sort and printRange
+	EvictionPolicy evictionPolicy = LRU_EVICTION;	// how the entry to evict is chosen
+	bool preallocateEntries = false;		// allocate every CacheEntry up front and recycle evicted ones
+	size_t maxWeightBytes = 0;				// byte budget for the cached entries; 0 = limit by entry count only
+	EntryWeigher weigher = payloadBytes;	// payload bytes charged per entry under maxWeightBytes
+	CacheClock clock = steadyClockMilliseconds;	// current time in milliseconds, for entries added with a ttl
+	int accessBufferStripes = 0;			// per-thread hit buffers for getItemDeferred; 0 = one per hardware thread
+	std::shared_mutex* evictionLock = nullptr;	// lock guarding the cache; set = evict in a background thread
+	double highWatermark = 0.95;			// fraction of the entry limit that wakes the background evictor
+	double lowWatermark = 0.90;				// fraction of the entry limit the background evictor evicts down to
+	std::pmr::memory_resource* memoryResource = nullptr;	// source of entries and table/tree storage (not owned; must
+													// outlive the CacheManager); nullptr = new/delete
+};
+
+#endif
@@ -5,6 +5,9 @@
 *
 * 04/20/25 - Imported file from Milestone 3
 * 04/21/25 - Fixed output formatting to match expected format
+* 10/18/26 - Added O(1) handle-based remove/moveNodeToHead/moveNodeToTail; key-based versions now find the node and delegate
+* 10/18/26 - Added unlink and detachAll; remove(DllNode*) is unlink + delete
+* 10/18/26 - Added insertAfter
 *
 */
 
@@ -101,6 +104,31 @@ void DoublyLinkedList::insertAtTail(int key, DllNode* newNode) {
     size++;
 }
 
+/**
+*
+* insertAfter
+*
+* Method to insert a new node right after a node already in the list
+*
+* @param    position    the node to insert after; must belong to this list
+* @param    newNode     the new dll node
+*
+* @return: nothing; updates doubly linked list and size
+*/
+void DoublyLinkedList::insertAfter(DllNode* position, DllNode* newNode) {
+    newNode->prev = position;
+    newNode->next = position->next;
+
+    if (position->next == nullptr) {
+        tail = newNode;
+    } else {
+        position->next->prev = newNode;
+    }
+
+    position->next = newNode;
+    size++;
+}
+
 /**
 *
 * remove
@@ -112,43 +140,77 @@ void DoublyLinkedList::insertAtTail(int key, DllNode* newNode) {
 * @return: nothing; updates doubly linked list
 */
 void DoublyLinkedList::remove(int key) {
-    if (isEmpty()) {
-        return;
-    }
-
     DllNode* current = head;
 
     while (current != nullptr) {
         if (current->key == key) {
-            // If it's the only node
-            if (head == tail) {
-                head = nullptr;
-                tail = nullptr;
-            }
-            // If it's the head
-            else if (current == head) {
-                head = head->next;
-                head->prev = nullptr;
-            }
-            // If it's the tail
-            else if (current == tail) {
-                tail = tail->prev;
-                tail->next = nullptr;
-            }
-            // If it's in the middle
-            else {
-                current->prev->next = current->next;
-                current->next->prev = current->prev;
-            }
-
-            delete current;
-            size--;
+            remove(current);
             return;
         }
         current = current->next;
     }
 }
 
+/**
+*
+* remove
+*
+* Method to remove a node the caller already holds, without searching the list
+*
+* @param: node   the node to unlink and delete; must belong to this list
+*
+* @return: nothing; updates doubly linked list
+*/
+void DoublyLinkedList::remove(DllNode* node) {
+    if (node == nullptr || isEmpty()) {
+        return;
+    }
+
+    unlink(node);
+    delete node;
+}
+
+/**
+*
+* unlink
+*
+* Method to take a node the caller already holds out of the list without deleting it
+*
+* @param: node   the node to unlink; must belong to this list
+*
+* @return: nothing; updates doubly linked list
+*/
+void DoublyLinkedList::unlink(DllNode* node) {
+    if (node == nullptr || isEmpty()) {
+        return;
+    }
+
+    // If it's the only node
+    if (head == tail) {
+        head = nullptr;
+        tail = nullptr;
+    }
+    // If it's the head
+    else if (node == head) {
+        head = head->next;
+        head->prev = nullptr;
+    }
+    // If it's the tail
+    else if (node == tail) {
+        tail = tail->prev;
+        tail->next = nullptr;
+    }
+    // If it's in the middle
+    else {
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+    }
+
+    node->prev = nullptr;
+    node->next = nullptr;
+    size--;
+}
+
 /**
 *
 * removeHeaderNode
@@ -226,26 +288,44 @@ void DoublyLinkedList::moveNodeToHead(int key) {
 
     while (current != nullptr) {
         if (current->key == key) {
-            // If it's the tail
-            if (current == tail) {
-                tail = current->prev;
-                tail->next = nullptr;
-            } else {
-                current->prev->next = current->next;
-                current->next->prev = current->prev;
-            }
-
-            // Move to head
-            current->next = head;
-            current->prev = nullptr;
-            head->prev = current;
-            head = current;
+            moveNodeToHead(current);
             return;
         }
         current = current->next;
     }
 }
 
+/**
+*
+* moveNodeToHead
+*
+* Method to move a node the caller already holds to the head of the list in O(1)
+*
+* @param: node   the node to move; must belong to this list
+*
+* @return: nothing; updates doubly linked list
+*/
+void DoublyLinkedList::moveNodeToHead(DllNode* node) {
+    if (node == nullptr || node == head) {
+        return;
+    }
+
+    // If it's the tail
+    if (node == tail) {
+        tail = node->prev;
+        tail->next = nullptr;
+    } else {
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+    }
+
+    // Move to head
+    node->next = head;
+    node->prev = nullptr;
+    head->prev = node;
+    head = node;
+}
+
 /**
 *
 * moveNodeToTail
@@ -265,28 +345,42 @@ void DoublyLinkedList::moveNodeToTail(int key) {
 
     while (current != nullptr) {
         if (current->key == key) {
-            if (current == tail) {
-                return;
-            }
-
-            if (current == head) {
-                head = current->next;
-                head->prev = nullptr;
-            } else {
-                current->prev->next = current->next;
-                current->next->prev = current->prev;
-            }
-
-            current->next = nullptr;
-            current->prev = tail;
-            tail->next = current;
-            tail = current;
+            moveNodeToTail(current);
             return;
         }
         current = current->next;
     }
 }
 
+/**
+*
+* moveNodeToTail
+*
+* Method to move a node the caller already holds to the tail of the list in O(1)
+*
+* @param: node   the node to move; must belong to this list
+*
+* @return: nothing; updates doubly linked list
+*/
+void DoublyLinkedList::moveNodeToTail(DllNode* node) {
+    if (node == nullptr || node == tail) {
+        return;
+    }
+
+    if (node == head) {
+        head = node->next;
+        head->prev = nullptr;
+    } else {
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+    }
+
+    node->next = nullptr;
+    node->prev = tail;
+    tail->next = node;
+    tail = node;
+}
+
 /**
 *
 * clear
@@ -310,6 +404,23 @@ void DoublyLinkedList::clear() {
     size = 0;
 }
 
+/**
+*
+* detachAll
+*
+* Method to empty the list without deleting its nodes; the caller still owns them
+* and can walk them through the old head's next pointers
+*
+* @param: none
+*
+* @return: nothing; reset size to 0
+*/
+void DoublyLinkedList::detachAll() {
+    head = nullptr;
+    tail = nullptr;
+    size = 0;
+}
+
 /**
 *
 * printList
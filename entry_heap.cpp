@@ -0,0 +1,187 @@
+/**
+*
+* @file entry_heap.cpp - Implementation of the indexed entry min-heap
+*
+* 10/18/26 - Created
+*/
+
+#include "entry_heap.h"
+
+EntryHeap::EntryHeap(int maxEntries, std::pmr::memory_resource* resource) : capacity(maxEntries), size(0), memoryResource(resource) {
+    heap = allocateArray<CacheEntry*>(memoryResource, capacity);
+}
+
+EntryHeap::~EntryHeap() {
+    deallocateArray(memoryResource, heap, capacity);
+}
+
+/**
+*
+* place
+*
+* Method to store entry at index and record the index in the entry
+*
+* @param    index   heap position
+* @param    entry   entry to store
+*
+* @return   nothing
+*/
+void EntryHeap::place(int index, CacheEntry* entry) {
+    heap[index] = entry;
+    entry->heapIndex = index;
+}
+
+/**
+*
+* siftUp
+*
+* Method to move the entry at index toward the root until its parent is not larger
+*
+* @param    index   heap position
+*
+* @return   nothing
+*/
+void EntryHeap::siftUp(int index) {
+    CacheEntry* entry = heap[index];
+
+    while (index > 0) {
+        int parent = (index - 1) / 2;
+        if (heap[parent]->priority <= entry->priority) {
+            break;
+        }
+
+        place(index, heap[parent]);
+        index = parent;
+    }
+
+    place(index, entry);
+}
+
+/**
+*
+* siftDown
+*
+* Method to move the entry at index toward the leaves until no child is smaller
+*
+* @param    index   heap position
+*
+* @return   nothing
+*/
+void EntryHeap::siftDown(int index) {
+    CacheEntry* entry = heap[index];
+
+    for (;;) {
+        int child = 2 * index + 1;
+        if (child >= size) {
+            break;
+        }
+
+        if (child + 1 < size && heap[child + 1]->priority < heap[child]->priority) {
+            child++;
+        }
+
+        if (entry->priority <= heap[child]->priority) {
+            break;
+        }
+
+        place(index, heap[child]);
+        index = child;
+    }
+
+    place(index, entry);
+}
+
+/**
+*
+* getSize
+*
+* Method to return the number of entries in the heap
+*
+* @param    none
+*
+* @return   number of entries
+*/
+int EntryHeap::getSize() {
+    return size;
+}
+
+/**
+*
+* top
+*
+* Method to return the entry with the lowest priority
+*
+* @param    none
+*
+* @return   that entry, or nullptr if the heap is empty
+*/
+CacheEntry* EntryHeap::top() {
+    return (size > 0) ? heap[0] : nullptr;
+}
+
+/**
+*
+* push
+*
+* Method to add an entry
+*
+* @param    entry   entry to add; its priority must be set, and the heap must not be full
+*
+* @return   nothing
+*/
+void EntryHeap::push(CacheEntry* entry) {
+    place(size, entry);
+    size++;
+    siftUp(size - 1);
+}
+
+/**
+*
+* update
+*
+* Method to restore heap order after an entry's priority changed
+*
+* @param    entry   an entry in the heap
+*
+* @return   nothing
+*/
+void EntryHeap::update(CacheEntry* entry) {
+    siftUp(entry->heapIndex);
+    siftDown(entry->heapIndex);
+}
+
+/**
+*
+* remove
+*
+* Method to take an entry out of the heap
+*
+* @param    entry   an entry in the heap
+*
+* @return   nothing
+*/
+void EntryHeap::remove(CacheEntry* entry) {
+    int index = entry->heapIndex;
+    size--;
+    entry->heapIndex = -1;
+
+    // Fill the hole with the last entry, which may belong above or below it
+    if (index < size) {
+        place(index, heap[size]);
+        update(heap[index]);
+    }
+}
+
+/**
+*
+* clear
+*
+* Method to remove every entry
+*
+* @param    none
+*
+* @return   nothing
+*/
+void EntryHeap::clear() {
+    size = 0;
+}
@@ -0,0 +1,145 @@
+/**
+*
+* entry_heap.h : This is the header file for entry_heap.cpp.
+*
+* 10/18/26 - Created; indexed min-heap of cache entries ordered by GDSF priority
+*/
+
+#ifndef _ENTRY_HEAP
+#define _ENTRY_HEAP
+
+#include "cache_entry.h"
+#include "memory_resources.h"
+
+// Define a class for a binary min-heap of cache entries keyed on their priority field
+//
+// Each entry records its own position in heapIndex, so an entry whose priority
+// changed can be re-sifted, and an entry removed from the cache can be taken out,
+// in O(log n) without searching. The array is allocated once at the cache's
+// maximum size and never grows.
+class EntryHeap {
+private:
+	CacheEntry** heap;
+	int capacity;
+	int size;
+
+	std::pmr::memory_resource* memoryResource;	// source of the heap array; nullptr = new/delete
+
+	/**
+	*
+	* place
+	*
+	* Method to store entry at index and record the index in the entry
+	*
+	* @param    index   heap position
+	* @param    entry   entry to store
+	*
+	* @return   nothing
+	*/
+	void place(int index, CacheEntry* entry);
+
+	/**
+	*
+	* siftUp
+	*
+	* Method to move the entry at index toward the root until its parent is not larger
+	*
+	* @param    index   heap position
+	*
+	* @return   nothing
+	*/
+	void siftUp(int index);
+
+	/**
+	*
+	* siftDown
+	*
+	* Method to move the entry at index toward the leaves until no child is smaller
+	*
+	* @param    index   heap position
+	*
+	* @return   nothing
+	*/
+	void siftDown(int index);
+
+public:
+	// Constructor allocates room for maxEntries entries from resource (new/delete if null)
+	EntryHeap(int maxEntries, std::pmr::memory_resource* resource = nullptr);
+
+	// Destructor frees the array; the entries are not owned by the heap
+	~EntryHeap();
+
+	/**
+	*
+	* getSize
+	*
+	* Method to return the number of entries in the heap
+	*
+	* @param    none
+	*
+	* @return   number of entries
+	*/
+	int getSize();
+
+	/**
+	*
+	* top
+	*
+	* Method to return the entry with the lowest priority
+	*
+	* @param    none
+	*
+	* @return   that entry, or nullptr if the heap is empty
+	*/
+	CacheEntry* top();
+
+	/**
+	*
+	* push
+	*
+	* Method to add an entry
+	*
+	* @param    entry   entry to add; its priority must be set, and the heap must not be full
+	*
+	* @return   nothing
+	*/
+	void push(CacheEntry* entry);
+
+	/**
+	*
+	* update
+	*
+	* Method to restore heap order after an entry's priority changed
+	*
+	* @param    entry   an entry in the heap
+	*
+	* @return   nothing
+	*/
+	void update(CacheEntry* entry);
+
+	/**
+	*
+	* remove
+	*
+	* Method to take an entry out of the heap
+	*
+	* @param    entry   an entry in the heap
+	*
+	* @return   nothing
+	*/
+	void remove(CacheEntry* entry);
+
+	/**
+	*
+	* clear
+	*
+	* Method to remove every entry
+	*
+	* @param    none
+	*
+	* @return   nothing
+	*/
+	void clear();
+};
+
+#endif
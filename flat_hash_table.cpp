@@ -0,0 +1,430 @@
+/**
+*
+* @file flat_hash_table.cpp - Implementation of the open-addressing hash table
+*
+* 10/18/26 - Created; Robin Hood linear probing with backward-shift deletion
+* 10/18/26 - Added findOrInsert and remove(curKey, removedNode); add probes once
+* 10/18/26 - Slot arrays are allocated from the table's memory resource
+* 10/18/26 - Added prefetch
+* 10/18/26 - Added getBytesPerItem
+* 10/18/26 - Lookups are const
+*/
+
+#include <iostream>
+#include <string>
+#include "flat_hash_table.h"
+
+extern void logToFileAndConsole(std::string msg);
+
+// Smallest table we allocate, and the maximum load factor (MAX_LOAD_NUMERATOR / 8)
+static const int MIN_CAPACITY = 8;
+static const int MAX_LOAD_NUMERATOR = 7;
+
+FlatHashTable::FlatHashTable(int hashTableSize, std::pmr::memory_resource* resource) : slots(nullptr), capacity(0), shift(32), numberOfItems(0), maxItems(0), memoryResource(resource) {
+    int newCapacity = MIN_CAPACITY;
+    while (newCapacity / 8 * MAX_LOAD_NUMERATOR < hashTableSize) {
+        newCapacity *= 2;
+    }
+
+    allocateSlots(newCapacity);
+}
+
+FlatHashTable::~FlatHashTable() {
+    deallocateArray(memoryResource, slots, capacity);
+}
+
+/**
+*
+* allocateSlots
+*
+* Method to allocate an empty slot array of newCapacity slots
+*
+* @param    newCapacity   number of slots, a power of two
+*
+* @return   nothing
+*/
+void FlatHashTable::allocateSlots(int newCapacity) {
+    slots = allocateArray<FlatSlot>(memoryResource, newCapacity);
+    for (int i = 0; i < newCapacity; i++) {
+        slots[i] = FlatSlot();
+    }
+
+    capacity = newCapacity;
+    maxItems = newCapacity / 8 * MAX_LOAD_NUMERATOR;
+
+    shift = 32;
+    for (int i = newCapacity; i > 1; i >>= 1) {
+        shift--;
+    }
+}
+
+/**
+*
+* rehash
+*
+* Method to move every entry into a new slot array of newCapacity slots
+*
+* @param    newCapacity   number of slots, a power of two
+*
+* @return   nothing
+*/
+void FlatHashTable::rehash(int newCapacity) {
+    FlatSlot* oldSlots = slots;
+    int oldCapacity = capacity;
+
+    allocateSlots(newCapacity);
+
+    for (int i = 0; i < oldCapacity; i++) {
+        if (oldSlots[i].probeLength != 0) {
+            insertSlot(calculateHashCode(oldSlots[i].key), 1, oldSlots[i].key, oldSlots[i].value);
+        }
+    }
+
+    deallocateArray(memoryResource, oldSlots, oldCapacity);
+}
+
+/**
+*
+* insertSlot
+*
+* Method to place a key that is known to be absent, displacing richer entries
+*
+* @param    index         first slot to try
+* @param    probeLength   probe length of curKey at index (1 at its home slot)
+* @param    curKey        key to place
+* @param    myNode        FIFO node the key refers to
+*
+* @return   the slot curKey was placed in
+*/
+int FlatHashTable::insertSlot(int index, int probeLength, int curKey, DllNode* myNode) {
+    int mask = capacity - 1;
+    int placedAt = -1;
+    FlatSlot incoming = { curKey, probeLength, myNode };
+
+    while (slots[index].probeLength != 0) {
+        // Robin Hood: take the slot from an entry that is closer to its home slot
+        if (slots[index].probeLength < incoming.probeLength) {
+            FlatSlot displaced = slots[index];
+            slots[index] = incoming;
+            incoming = displaced;
+
+            if (placedAt == -1) {
+                placedAt = index;
+            }
+        }
+
+        index = (index + 1) & mask;
+        incoming.probeLength++;
+    }
+
+    slots[index] = incoming;
+    return (placedAt == -1) ? index : placedAt;
+}
+
+/**
+*
+* findSlot
+*
+* Method to find the slot holding curKey
+*
+* @param    curKey    key to look up
+*
+* @return   slot index, or -1 if not found
+*/
+int FlatHashTable::findSlot(int curKey) const {
+    int mask = capacity - 1;
+    int index = calculateHashCode(curKey);
+    int probeLength = 1;
+
+    // An entry closer to its home slot than we are means curKey would have displaced it
+    while (slots[index].probeLength >= probeLength) {
+        if (slots[index].key == curKey) {
+            return index;
+        }
+        index = (index + 1) & mask;
+        probeLength++;
+    }
+
+    return -1;
+}
+
+/**
+*
+* getSize
+*
+* Method to return the number of slots
+*
+* @param    none
+*
+* @return	number of slots
+*/
+int FlatHashTable::getSize() {
+    return capacity;
+}
+
+/**
+*
+* calculateHashCode
+*
+* Method to calculate the home slot with Fibonacci hashing
+*
+* @param    currentKey     key to hash
+*
+* @return   home slot for currentKey
+*/
+int FlatHashTable::calculateHashCode(int currentKey) const {
+    return (int)(((unsigned int)currentKey * 2654435769u) >> shift);
+}
+
+/**
+*
+* isEmpty
+*
+* Method to check if FlatHashTable is empty
+*
+* @param    none
+*
+* @return   true if the table has zero entries, false otherwise
+*/
+bool FlatHashTable::isEmpty() {
+    return numberOfItems == 0;
+}
+
+/**
+*
+* getNumberOfItems
+*
+* Method to return number of items in the table
+*
+* @param    none
+*
+* @return   number of items in the table
+*/
+int FlatHashTable::getNumberOfItems() {
+    return numberOfItems;
+}
+
+/**
+*
+* add
+*
+* Method to map curKey to myNode, growing the table when it is too full
+*
+* @param    curKey    key for this node
+* @param    myNode    FIFO node the key refers to
+*
+* @return   true if success, false if the key was already present
+*/
+bool FlatHashTable::add(int curKey, DllNode* myNode) {
+    bool inserted;
+    findOrInsert(curKey, myNode, inserted);
+
+    return inserted;
+}
+
+/**
+*
+* findOrInsert
+*
+* Method to look up curKey and, if it is absent, insert it where the lookup stopped
+*
+* @param    curKey      key to look up or insert
+* @param    myNode      FIFO node to map curKey to if it is absent
+* @param    inserted    set to true if curKey was inserted, false if it was already present
+*
+* @return   the slot's FIFO node pointer for curKey
+*/
+DllNode** FlatHashTable::findOrInsert(int curKey, DllNode* myNode, bool& inserted) {
+    int mask = capacity - 1;
+    int index = calculateHashCode(curKey);
+    int probeLength = 1;
+
+    while (slots[index].probeLength >= probeLength) {
+        if (slots[index].key == curKey) {
+            inserted = false;
+            return &slots[index].value;
+        }
+        index = (index + 1) & mask;
+        probeLength++;
+    }
+
+    // The miss stopped where curKey belongs, unless the table has to grow first
+    if (numberOfItems >= maxItems) {
+        rehash(capacity * 2);
+        index = insertSlot(calculateHashCode(curKey), 1, curKey, myNode);
+    } else {
+        index = insertSlot(index, probeLength, curKey, myNode);
+    }
+
+    numberOfItems++;
+    inserted = true;
+    return &slots[index].value;
+}
+
+/**
+*
+* remove
+*
+* Method to remove curKey, shifting the following entries back one slot
+*
+* @param    curKey  key of entry to remove
+*
+* @return   true if success, false otherwise
+*/
+bool FlatHashTable::remove(int curKey) {
+    DllNode* removedNode;
+
+    return remove(curKey, removedNode);
+}
+
+/**
+*
+* remove
+*
+* Method to remove curKey and hand back its FIFO node
+*
+* @param    curKey          key of entry to remove
+* @param    removedNode     set to the FIFO node of the removed entry
+*
+* @return   true if success, false otherwise
+*/
+bool FlatHashTable::remove(int curKey, DllNode*& removedNode) {
+    int index = findSlot(curKey);
+    if (index == -1) {
+        return false;
+    }
+
+    removedNode = slots[index].value;
+
+    int mask = capacity - 1;
+    int next = (index + 1) & mask;
+
+    // Backward shift: pull displaced followers one step closer to home instead of leaving a tombstone
+    while (slots[next].probeLength > 1) {
+        slots[index] = slots[next];
+        slots[index].probeLength--;
+
+        index = next;
+        next = (next + 1) & mask;
+    }
+
+    slots[index].probeLength = 0;
+    numberOfItems--;
+    return true;
+}
+
+/**
+*
+* clear
+*
+* Method to remove all entries from the table
+*
+* @param    none
+*
+* @return   nothing
+*/
+void FlatHashTable::clear() {
+    for (int i = 0; i < capacity; i++) {
+        slots[i].probeLength = 0;
+    }
+
+    numberOfItems = 0;
+}
+
+/**
+*
+* getItem
+*
+* Method to retrieve the FIFO node mapped to curKey
+*
+* @param    curKey  key to look up
+*
+* @return   pointer to the DllNode, or nullptr if not found
+*/
+DllNode* FlatHashTable::getItem(int curKey) const {
+    int index = findSlot(curKey);
+
+    return (index == -1) ? nullptr : slots[index].value;
+}
+
+/**
+*
+* contains
+*
+* Method to verify if a key is in the table
+*
+* @param    curKey  key to look up
+*
+* @return   true if found, false otherwise
+*/
+bool FlatHashTable::contains(int curKey) const {
+    return findSlot(curKey) != -1;
+}
+
+/**
+*
+* prefetch
+*
+* Method to start loading curKey's home slot
+*
+* @param    curKey  key that will be looked up soon
+*
+* @return   nothing
+*/
+void FlatHashTable::prefetch(int curKey) const {
+    prefetchForRead(&slots[calculateHashCode(curKey)]);
+}
+
+/**
+*
+* getMemoryUsage
+*
+* Method to return the bytes held by the slot array
+*
+* @param    none
+*
+* @return   bytes used by the table
+*/
+size_t FlatHashTable::getMemoryUsage() {
+    return sizeof(FlatHashTable) + capacity * sizeof(FlatSlot);
+}
+
+/**
+*
+* getBytesPerItem
+*
+* Method to return the index storage one item accounts for at the maximum load factor
+*
+* @param    none
+*
+* @return   bytes per item
+*/
+size_t FlatHashTable::getBytesPerItem() {
+    return sizeof(FlatSlot) * 8 / MAX_LOAD_NUMERATOR;
+}
+
+/**
+*
+* printTable
+*
+* Method to print out the contents of table
+*
+* @param    none
+*
+* @return   nothing, but output is sent to console and to file
+*/
+void FlatHashTable::printTable() {
+    for (int i = 0; i < capacity; i++) {
+        if (slots[i].probeLength == 0) {
+            logToFileAndConsole("Empty slot: " + std::to_string(i));
+        } else {
+            logToFileAndConsole("\nSlot " + std::to_string(i) + ": ");
+
+            if (slots[i].value != nullptr) {
+                slots[i].value->printNode();
+            } else {
+                logToFileAndConsole("Hash slot with key: " + std::to_string(slots[i].key));
+            }
+        }
+    }
+}
@@ -0,0 +1,287 @@
+/**
+*
+* flat_hash_table.h : This is the header file for flat_hash_table.cpp.
+*
+* 10/18/26 - Created; open-addressing (Robin Hood linear probing) alternative to the chained HashTable
+* 10/18/26 - Added findOrInsert and remove(curKey, removedNode); add probes once
+* 10/18/26 - The slot array comes from an optional std::pmr::memory_resource
+* 10/18/26 - Added prefetch
+* 10/18/26 - Added getBytesPerItem
+* 10/18/26 - Lookups are const
+*/
+
+#ifndef _FLAT_HASH_TABLE
+#define _FLAT_HASH_TABLE
+
+#include "hash_index.h"
+#include "memory_resources.h"
+
+// One open-addressing slot; the key, probe length and FIFO node pointer share a cache line
+struct FlatSlot {
+	int key;
+	int probeLength;				// 0 = empty slot, otherwise distance from the home slot + 1
+	DllNode* value;
+};
+
+// Define a class for the open-addressing hash table
+//
+// Entries live in one contiguous slot array, so a lookup scans neighbouring slots
+// instead of chasing chain nodes. Slots are kept in Robin Hood order (entries that
+// are further from their home slot win), which lets a miss stop as soon as it
+// meets an entry closer to home than itself.
+class FlatHashTable : public HashIndex {
+private:
+	FlatSlot* slots;
+
+	int capacity;					// number of slots, always a power of two
+	int shift;						// 32 - log2(capacity), used by calculateHashCode
+	int numberOfItems;
+	int maxItems;					// grow once numberOfItems would exceed this
+
+	std::pmr::memory_resource* memoryResource;	// source of slot arrays; nullptr = new/delete
+
+	/**
+	*
+	* allocateSlots
+	*
+	* Method to allocate an empty slot array of newCapacity slots
+	*
+	* @param    newCapacity   number of slots, a power of two
+	*
+	* @return   nothing
+	*/
+	void allocateSlots(int newCapacity);
+
+	/**
+	*
+	* rehash
+	*
+	* Method to move every entry into a new slot array of newCapacity slots
+	*
+	* @param    newCapacity   number of slots, a power of two
+	*
+	* @return   nothing
+	*/
+	void rehash(int newCapacity);
+
+	/**
+	*
+	* insertSlot
+	*
+	* Method to place a key that is known to be absent, displacing richer entries
+	*
+	* @param    index         first slot to try
+	* @param    probeLength   probe length of curKey at index (1 at its home slot)
+	* @param    curKey        key to place
+	* @param    myNode        FIFO node the key refers to
+	*
+	* @return   the slot curKey was placed in
+	*/
+	int insertSlot(int index, int probeLength, int curKey, DllNode* myNode);
+
+	/**
+	*
+	* findSlot
+	*
+	* Method to find the slot holding curKey
+	*
+	* @param    curKey    key to look up
+	*
+	* @return   slot index, or -1 if not found
+	*/
+	int findSlot(int curKey) const;
+
+public:
+	// Constructor sizes the table so that hashTableSize entries fit under the maximum load factor;
+	// slot arrays come from resource (new/delete if null)
+	FlatHashTable(int hashTableSize, std::pmr::memory_resource* resource = nullptr);
+
+	// Destructor frees the slot array; FIFO nodes are not owned by the table
+	~FlatHashTable();
+
+	/**
+	*
+	* getSize
+	*
+	* Method to return the number of slots
+	*
+	* @param    none
+	*
+	* @return	number of slots
+	*/
+	int getSize();
+
+	/**
+	*
+	* calculateHashCode
+	*
+	* Method to calculate the home slot with Fibonacci hashing
+	*
+	* @param    currentKey     key to hash
+	*
+	* @return   home slot for currentKey
+	*/
+	int calculateHashCode(int currentKey) const;
+
+	/**
+	*
+	* isEmpty
+	*
+	* Method to check if FlatHashTable is empty
+	*
+	* @param    none
+	*
+	* @return   true if the table has zero entries, false otherwise
+	*/
+	bool isEmpty();
+
+	/**
+	*
+	* getNumberOfItems
+	*
+	* Method to return number of items in the table
+	*
+	* @param    none
+	*
+	* @return   number of items in the table
+	*/
+	int getNumberOfItems();
+
+	/**
+	*
+	* add
+	*
+	* Method to map curKey to myNode, growing the table when it is too full
+	*
+	* @param    curKey    key for this node
+	* @param    myNode    FIFO node the key refers to
+	*
+	* @return   true if success, false if the key was already present
+	*/
+	bool add(int curKey, DllNode* myNode);
+
+	/**
+	*
+	* findOrInsert
+	*
+	* Method to look up curKey and, if it is absent, insert it where the lookup stopped
+	*
+	* @param    curKey      key to look up or insert
+	* @param    myNode      FIFO node to map curKey to if it is absent
+	* @param    inserted    set to true if curKey was inserted, false if it was already present
+	*
+	* @return   the slot's FIFO node pointer for curKey
+	*/
+	DllNode** findOrInsert(int curKey, DllNode* myNode, bool& inserted);
+
+	/**
+	*
+	* remove
+	*
+	* Method to remove curKey, shifting the following entries back one slot
+	*
+	* @param    curKey  key of entry to remove
+	*
+	* @return   true if success, false otherwise
+	*/
+	bool remove(int curKey);
+
+	/**
+	*
+	* remove
+	*
+	* Method to remove curKey and hand back its FIFO node
+	*
+	* @param    curKey          key of entry to remove
+	* @param    removedNode     set to the FIFO node of the removed entry
+	*
+	* @return   true if success, false otherwise
+	*/
+	bool remove(int curKey, DllNode*& removedNode);
+
+	/**
+	*
+	* clear
+	*
+	* Method to remove all entries from the table
+	*
+	* @param    none
+	*
+	* @return   nothing
+	*/
+	void clear();
+
+	/**
+	*
+	* getItem
+	*
+	* Method to retrieve the FIFO node mapped to curKey
+	*
+	* @param    curKey  key to look up
+	*
+	* @return   pointer to the DllNode, or nullptr if not found
+	*/
+	DllNode* getItem(int curKey) const;
+
+	/**
+	*
+	* contains
+	*
+	* Method to verify if a key is in the table
+	*
+	* @param    curKey  key to look up
+	*
+	* @return   true if found, false otherwise
+	*/
+	bool contains(int curKey) const;
+
+	/**
+	*
+	* prefetch
+	*
+	* Method to start loading curKey's home slot
+	*
+	* @param    curKey  key that will be looked up soon
+	*
+	* @return   nothing
+	*/
+	void prefetch(int curKey) const;
+
+	/**
+	*
+	* getMemoryUsage
+	*
+	* Method to return the bytes held by the slot array
+	*
+	* @param    none
+	*
+	* @return   bytes used by the table
+	*/
+	size_t getMemoryUsage();
+
+	/**
+	*
+	* getBytesPerItem
+	*
+	* Method to return the index storage one item accounts for at the maximum load factor
+	*
+	* @param    none
+	*
+	* @return   bytes per item
+	*/
+	size_t getBytesPerItem();
+
+	/**
+	*
+	* printTable
+	*
+	* Method to print out the contents of table
+	*
+	* @param    none
+	*
+	* @return   nothing, but output is sent to console and to file
+	*/
+	void printTable();
+};
+
+#endif
@@ -0,0 +1,136 @@
+/**
+*
+* @file frequency_sketch.cpp - Implementation of the count-min frequency sketch
+*
+* 10/18/26 - Created
+*/
+
+#include "frequency_sketch.h"
+#include "hash_policy.h"
+
+// Every nibble of a word is one counter; this keeps the low three bits of each after a shift
+static const uint64_t HALF_MASK = 0x7777777777777777ull;
+
+FrequencySketch::FrequencySketch(int expectedEntries, std::pmr::memory_resource* resource) : memoryResource(resource) {
+    int countersPerRow = roundUpToPowerOfTwo(expectedEntries < 16 ? 16 : expectedEntries);
+
+    wordsPerRow = countersPerRow / 16;
+    counterMask = countersPerRow - 1;
+    sampleSize = (expectedEntries < 1 ? 1 : expectedEntries) * 10;
+    additions = 0;
+
+    table = allocateArray<uint64_t>(memoryResource, DEPTH * wordsPerRow);
+    for (int i = 0; i < DEPTH * wordsPerRow; i++) {
+        table[i] = 0;
+    }
+}
+
+FrequencySketch::~FrequencySketch() {
+    deallocateArray(memoryResource, table, DEPTH * wordsPerRow);
+}
+
+/**
+*
+* counterIndex
+*
+* Method to pick curKey's counter in one row
+*
+* @param    curKey  key to look up
+* @param    row     row number, 0 to DEPTH - 1
+*
+* @return   counter index within the row
+*/
+int FrequencySketch::counterIndex(int curKey, int row) const {
+    // Two independent mixes of the key; row i uses h1 + i * h2 (double hashing)
+    uint64_t h1 = (uint64_t)(uint32_t)curKey * 0x9E3779B97F4A7C15ull;
+    uint64_t h2 = ((uint64_t)(uint32_t)curKey ^ 0x5bd1e995u) * 0xC2B2AE3D27D4EB4Full;
+
+    return (int)(((h1 >> 32) + (uint64_t)row * ((h2 >> 32) | 1)) & (uint64_t)counterMask);
+}
+
+/**
+*
+* increment
+*
+* Method to record one occurrence of curKey, aging the sketch when the sample is full
+*
+* @param    curKey  key that was seen
+*
+* @return   nothing
+*/
+void FrequencySketch::increment(int curKey) {
+    bool added = false;
+
+    for (int row = 0; row < DEPTH; row++) {
+        int index = counterIndex(curKey, row);
+        uint64_t& word = table[row * wordsPerRow + (index >> 4)];
+        int shift = (index & 15) * 4;
+
+        if (((word >> shift) & 0xF) != 0xF) {
+            word += (uint64_t)1 << shift;
+            added = true;
+        }
+    }
+
+    // Saturated keys do not count toward the sample, so a few very hot keys cannot force aging
+    if (added && ++additions >= sampleSize) {
+        age();
+    }
+}
+
+/**
+*
+* frequency
+*
+* Method to estimate how often curKey has been seen since the counters were last aged
+*
+* @param    curKey  key to look up
+*
+* @return   estimated count, 0 to 15
+*/
+int FrequencySketch::frequency(int curKey) const {
+    int estimate = 0xF;
+
+    for (int row = 0; row < DEPTH; row++) {
+        int index = counterIndex(curKey, row);
+        int count = (int)((table[row * wordsPerRow + (index >> 4)] >> ((index & 15) * 4)) & 0xF);
+
+        if (count < estimate) {
+            estimate = count;
+        }
+    }
+
+    return estimate;
+}
+
+/**
+*
+* age
+*
+* Method to halve every counter
+*
+* @param    none
+*
+* @return   nothing
+*/
+void FrequencySketch::age() {
+    for (int i = 0; i < DEPTH * wordsPerRow; i++) {
+        table[i] = (table[i] >> 1) & HALF_MASK;
+    }
+
+    additions /= 2;
+}
+
+/**
+*
+* getMemoryUsage
+*
+* Method to return the bytes held by the counter table
+*
+* @param    none
+*
+* @return   bytes used by the sketch
+*/
+size_t FrequencySketch::getMemoryUsage() const {
+    return sizeof(uint64_t) * DEPTH * wordsPerRow;
+}
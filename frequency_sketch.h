@@ -0,0 +1,104 @@
+/**
+*
+* frequency_sketch.h : This is the header file for frequency_sketch.cpp.
+*
+* 10/18/26 - Created; count-min sketch of 4-bit counters with periodic aging, used by W-TinyLFU admission
+*/
+
+#ifndef _FREQUENCY_SKETCH
+#define _FREQUENCY_SKETCH
+
+#include <cstdint>
+#include "memory_resources.h"
+
+// Define a class that estimates how often each key has been seen recently
+//
+// Four rows of 4-bit counters, sixteen to a 64-bit word. A key bumps one counter per
+// row, and its estimate is the smallest of the four, so collisions can only push an
+// estimate up. Counters stop at 15: admission only has to tell popular keys from
+// rare ones. After sampleSize increments every counter is halved, so keys that
+// were popular long ago fade out and the sketch follows the current workload.
+class FrequencySketch {
+private:
+	static const int DEPTH = 4;		// rows; one counter per row per key
+
+	uint64_t* table;				// DEPTH rows of wordsPerRow words
+	int wordsPerRow;
+	int counterMask;				// counters per row - 1; counters per row is a power of two
+
+	int sampleSize;					// increments between agings
+	int additions;					// increments since the last aging
+
+	std::pmr::memory_resource* memoryResource;	// source of the counter table; nullptr = new/delete
+
+	/**
+	*
+	* counterIndex
+	*
+	* Method to pick curKey's counter in one row
+	*
+	* @param    curKey  key to look up
+	* @param    row     row number, 0 to DEPTH - 1
+	*
+	* @return   counter index within the row
+	*/
+	int counterIndex(int curKey, int row) const;
+
+	/**
+	*
+	* age
+	*
+	* Method to halve every counter
+	*
+	* @param    none
+	*
+	* @return   nothing
+	*/
+	void age();
+
+public:
+	// Constructor sizes the rows for expectedEntries distinct keys (at least 16 counters per row)
+	// and ages every ten increments per expected key; the table comes from resource (new/delete if null)
+	FrequencySketch(int expectedEntries, std::pmr::memory_resource* resource = nullptr);
+
+	// Destructor frees the counter table
+	~FrequencySketch();
+
+	/**
+	*
+	* increment
+	*
+	* Method to record one occurrence of curKey, aging the sketch when the sample is full
+	*
+	* @param    curKey  key that was seen
+	*
+	* @return   nothing
+	*/
+	void increment(int curKey);
+
+	/**
+	*
+	* frequency
+	*
+	* Method to estimate how often curKey has been seen since the counters were last aged
+	*
+	* @param    curKey  key to look up
+	*
+	* @return   estimated count, 0 to 15
+	*/
+	int frequency(int curKey) const;
+
+	/**
+	*
+	* getMemoryUsage
+	*
+	* Method to return the bytes held by the counter table
+	*
+	* @param    none
+	*
+	* @return   bytes used by the sketch
+	*/
+	size_t getMemoryUsage() const;
+};
+
+#endif
@@ -0,0 +1,142 @@
+/**
+*
+* @file ghost_list.cpp - Implementation of the ghost key list
+*
+* 10/18/26 - Created
+*/
+
+#include "ghost_list.h"
+
+GhostList::GhostList(int expectedKeys, std::pmr::memory_resource* resource)
+    : index(expectedKeys, resource), freeNodes(nullptr), memoryResource(resource) {}
+
+GhostList::~GhostList() {
+    clear();
+
+    while (freeNodes != nullptr) {
+        DllNode* next = freeNodes->next;
+        deleteObject(memoryResource, freeNodes);
+        freeNodes = next;
+    }
+}
+
+/**
+*
+* unlinkNode
+*
+* Method to take a node off the list and put it on the free list
+*
+* @param    node    node to release; already removed from index
+*
+* @return   nothing
+*/
+void GhostList::unlinkNode(DllNode* node) {
+    keys.unlink(node);
+
+    node->prev = nullptr;
+    node->next = freeNodes;
+    freeNodes = node;
+}
+
+/**
+*
+* getSize
+*
+* Method to return the number of ghost keys
+*
+* @param    none
+*
+* @return   number of keys
+*/
+int GhostList::getSize() {
+    return keys.getSize();
+}
+
+/**
+*
+* contains
+*
+* Method to check if curKey is a ghost key
+*
+* @param    curKey  key to look up
+*
+* @return   true if found, false otherwise
+*/
+bool GhostList::contains(int curKey) {
+    return index.contains(curKey);
+}
+
+/**
+*
+* insertAtHead
+*
+* Method to add curKey as the most recently evicted key
+*
+* @param    curKey  key to add; must not already be on the list
+*
+* @return   nothing
+*/
+void GhostList::insertAtHead(int curKey) {
+    DllNode* node = freeNodes;
+    if (node != nullptr) {
+        freeNodes = node->next;
+        node->key = curKey;
+    } else {
+        node = newObject<DllNode>(memoryResource, curKey);
+    }
+
+    keys.insertAtHead(curKey, node);
+    index.add(curKey, node);
+}
+
+/**
+*
+* remove
+*
+* Method to remove curKey
+*
+* @param    curKey  key to remove
+*
+* @return   true if it was on the list, false otherwise
+*/
+bool GhostList::remove(int curKey) {
+    DllNode* node;
+    if (!index.remove(curKey, node)) {
+        return false;
+    }
+
+    unlinkNode(node);
+    return true;
+}
+
+/**
+*
+* removeOldest
+*
+* Method to remove the least recently evicted key
+*
+* @param    none
+*
+* @return   nothing; does nothing if the list is empty
+*/
+void GhostList::removeOldest() {
+    if (keys.tail != nullptr) {
+        remove(keys.tail->key);
+    }
+}
+
+/**
+*
+* clear
+*
+* Method to remove every key
+*
+* @param    none
+*
+* @return   nothing
+*/
+void GhostList::clear() {
+    while (keys.tail != nullptr) {
+        removeOldest();
+    }
+}
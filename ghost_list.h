@@ -0,0 +1,121 @@
+/**
+*
+* ghost_list.h : This is the header file for ghost_list.cpp.
+*
+* 10/18/26 - Created; bounded history of recently evicted keys, used by ARC
+*/
+
+#ifndef _GHOST_LIST
+#define _GHOST_LIST
+
+#include "doubly_linked_list.h"
+#include "flat_hash_table.h"
+#include "memory_resources.h"
+
+// Define a class for a list of keys whose entries have been evicted
+//
+// A ghost list keeps only keys, newest at the head, so an eviction policy can tell
+// that a key it is asked to add was cached a short while ago. Keys are found and
+// removed in O(1) through an open-addressing index. Nodes of removed keys are kept
+// on a free list and reused, so a ghost list at its steady size does not allocate.
+class GhostList {
+private:
+	DoublyLinkedList keys;			// ghost keys, most recently evicted at the head
+	FlatHashTable index;			// key -> its node on keys
+	DllNode* freeNodes;				// nodes of removed keys, linked through next
+
+	std::pmr::memory_resource* memoryResource;	// source of nodes; nullptr = new/delete
+
+	/**
+	*
+	* unlinkNode
+	*
+	* Method to take a node off the list and put it on the free list
+	*
+	* @param    node    node to release; already removed from index
+	*
+	* @return   nothing
+	*/
+	void unlinkNode(DllNode* node);
+
+public:
+	// Constructor sizes the index for expectedKeys keys; nodes come from resource (new/delete if null)
+	GhostList(int expectedKeys, std::pmr::memory_resource* resource = nullptr);
+
+	// Destructor frees every node, on the list or on the free list
+	~GhostList();
+
+	/**
+	*
+	* getSize
+	*
+	* Method to return the number of ghost keys
+	*
+	* @param    none
+	*
+	* @return   number of keys
+	*/
+	int getSize();
+
+	/**
+	*
+	* contains
+	*
+	* Method to check if curKey is a ghost key
+	*
+	* @param    curKey  key to look up
+	*
+	* @return   true if found, false otherwise
+	*/
+	bool contains(int curKey);
+
+	/**
+	*
+	* insertAtHead
+	*
+	* Method to add curKey as the most recently evicted key
+	*
+	* @param    curKey  key to add; must not already be on the list
+	*
+	* @return   nothing
+	*/
+	void insertAtHead(int curKey);
+
+	/**
+	*
+	* remove
+	*
+	* Method to remove curKey
+	*
+	* @param    curKey  key to remove
+	*
+	* @return   true if it was on the list, false otherwise
+	*/
+	bool remove(int curKey);
+
+	/**
+	*
+	* removeOldest
+	*
+	* Method to remove the least recently evicted key
+	*
+	* @param    none
+	*
+	* @return   nothing; does nothing if the list is empty
+	*/
+	void removeOldest();
+
+	/**
+	*
+	* clear
+	*
+	* Method to remove every key
+	*
+	* @param    none
+	*
+	* @return   nothing
+	*/
+	void clear();
+};
+
+#endif
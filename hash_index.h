@@ -0,0 +1,273 @@
+/**
+*
+* hash_index.h : This is the interface shared by the hash table engines used by CacheManager.
+*
+* 10/18/26 - Created; HashTable (separate chaining) and FlatHashTable (open addressing) both implement it
+* 10/18/26 - Added SWISS_TABLE engine (SwissHashTable)
+* 10/18/26 - Added findOrInsert and remove(curKey, removedNode) so callers probe the index once
+* 10/18/26 - Added findOrAttach, detach and detachAll for CacheEntry-owned links
+* 10/18/26 - Added prefetch and prefetchForRead for batched lookups
+* 10/18/26 - Added getBytesPerItem for byte-weighted cache capacity
+* 10/18/26 - getItem, contains and prefetch are const: lookups never change the table
+*/
+
+#ifndef _HASH_INDEX
+#define _HASH_INDEX
+
+#include <cstddef>
+#include "cache_entry.h"
+
+/**
+*
+* prefetchForRead
+*
+* function to ask the CPU to start loading address into cache; a no-op where the builtin is unavailable
+*
+* @param    address     memory that will be read soon
+*
+* @return   nothing
+*/
+inline void prefetchForRead(const void* address) {
+#if defined(__GNUC__) || defined(__clang__)
+	__builtin_prefetch(address, 0, 3);
+#else
+	(void)address;
+#endif
+}
+
+// Hash table engines that CacheManager can be configured with
+enum HashEngine { CHAINED = 0, OPEN_ADDRESSING = 1, SWISS_TABLE = 2 };
+
+// Define the interface for a key -> FIFO node hash index
+//
+// The const methods only read the table: an incremental resize advances on add and
+// remove, never on a lookup, so any number of threads may call them together while
+// no thread modifies the index.
+class HashIndex {
+public:
+	virtual ~HashIndex() {}
+
+	/**
+	*
+	* getSize
+	*
+	* Method to return the number of buckets (or slots) in the index
+	*
+	* @param    none
+	*
+	* @return	number of buckets or slots
+	*/
+	virtual int getSize() = 0;
+
+	/**
+	*
+	* isEmpty
+	*
+	* Method to check if the index is empty
+	*
+	* @param    none
+	*
+	* @return   true if the index has zero entries, false otherwise
+	*/
+	virtual bool isEmpty() = 0;
+
+	/**
+	*
+	* getNumberOfItems
+	*
+	* Method to return number of items in the index
+	*
+	* @param    none
+	*
+	* @return   number of items in the index
+	*/
+	virtual int getNumberOfItems() = 0;
+
+	/**
+	*
+	* add
+	*
+	* Method to map curKey to myNode
+	*
+	* @param    curKey    key for this node
+	* @param    myNode    FIFO node the key refers to
+	*
+	* @return   true if success, false if the key was already present
+	*/
+	virtual bool add(int curKey, DllNode* myNode) = 0;
+
+	/**
+	*
+	* findOrInsert
+	*
+	* Method to look up curKey and, if it is absent, map it to myNode, in a single probe
+	*
+	* @param    curKey      key to look up or insert
+	* @param    myNode      FIFO node to map curKey to if it is absent
+	* @param    inserted    set to true if curKey was inserted, false if it was already present
+	*
+	* @return   the slot holding curKey's FIFO node; the caller may overwrite it to update an
+	*           existing entry. Valid until the next add or remove.
+	*/
+	virtual DllNode** findOrInsert(int curKey, DllNode* myNode, bool& inserted) = 0;
+
+	/**
+	*
+	* findOrAttach
+	*
+	* Method to look up curKey and, if it is absent, map it to entry without allocating; an
+	* engine that chains nodes links entry->hashLinks in place. By default the entry is
+	* stored like any other FIFO node.
+	*
+	* @param    curKey      key to look up or insert
+	* @param    entry       cache entry to map curKey to if it is absent
+	* @param    inserted    set to true if curKey was inserted, false if it was already present
+	*
+	* @return   the slot holding curKey's FIFO node, as for findOrInsert
+	*/
+	virtual DllNode** findOrAttach(int curKey, CacheEntry* entry, bool& inserted) {
+		return findOrInsert(curKey, entry, inserted);
+	}
+
+	/**
+	*
+	* remove
+	*
+	* Method to remove the entry with curKey; the FIFO node itself is not deleted
+	*
+	* @param    curKey  key of entry to remove
+	*
+	* @return   true if success, false otherwise
+	*/
+	virtual bool remove(int curKey) = 0;
+
+	/**
+	*
+	* remove
+	*
+	* Method to remove the entry with curKey and hand back the FIFO node it mapped to
+	*
+	* @param    curKey          key of entry to remove
+	* @param    removedNode     set to the FIFO node of the removed entry
+	*
+	* @return   true if success, false otherwise
+	*/
+	virtual bool remove(int curKey, DllNode*& removedNode) = 0;
+
+	/**
+	*
+	* detach
+	*
+	* Method to remove an entry added with findOrAttach; nothing the caller owns is deleted
+	*
+	* @param    curKey          key of entry to remove
+	* @param    removedNode     set to the FIFO node (the CacheEntry) of the removed entry
+	*
+	* @return   true if success, false otherwise
+	*/
+	virtual bool detach(int curKey, DllNode*& removedNode) {
+		return remove(curKey, removedNode);
+	}
+
+	/**
+	*
+	* clear
+	*
+	* Method to remove all entries from the index
+	*
+	* @param    none
+	*
+	* @return   nothing
+	*/
+	virtual void clear() = 0;
+
+	/**
+	*
+	* detachAll
+	*
+	* Method to remove every entry added with findOrAttach without deleting any of them
+	*
+	* @param    none
+	*
+	* @return   nothing
+	*/
+	virtual void detachAll() {
+		clear();
+	}
+
+	/**
+	*
+	* getItem
+	*
+	* Method to retrieve the FIFO node mapped to curKey
+	*
+	* @param    curKey  key to look up
+	*
+	* @return   pointer to the DllNode, or nullptr if not found
+	*/
+	virtual DllNode* getItem(int curKey) const = 0;
+
+	/**
+	*
+	* contains
+	*
+	* Method to verify if a key is in the index
+	*
+	* @param    curKey  key to look up
+	*
+	* @return   true if found, false otherwise
+	*/
+	virtual bool contains(int curKey) const = 0;
+
+	/**
+	*
+	* prefetch
+	*
+	* Method to start loading the memory a lookup of curKey reads first, without waiting for it;
+	* batched callers prefetch every key, then look them up. By default it does nothing.
+	*
+	* @param    curKey  key that will be looked up soon
+	*
+	* @return   nothing
+	*/
+	virtual void prefetch(int /*curKey*/) const {}
+
+	/**
+	*
+	* getMemoryUsage
+	*
+	* Method to return the bytes held by the index itself (buckets, slots and chain nodes, not FIFO nodes)
+	*
+	* @param    none
+	*
+	* @return   bytes used by the index
+	*/
+	virtual size_t getMemoryUsage() = 0;
+
+	/**
+	*
+	* getBytesPerItem
+	*
+	* Method to return the index storage one item accounts for when the table is at its maximum
+	* load factor: its share of the buckets or slots, not counting chain nodes held by the item
+	*
+	* @param    none
+	*
+	* @return   bytes per item
+	*/
+	virtual size_t getBytesPerItem() = 0;
+
+	/**
+	*
+	* printTable
+	*
+	* Method to print out the contents of the index
+	*
+	* @param    none
+	*
+	* @return   nothing, but output is sent to console and to file
+	*/
+	virtual void printTable() = 0;
+};
+
+#endif
@@ -0,0 +1,115 @@
+/**
+*
+* hash_policy.h : Bucket selection policies for the chained HashTable.
+*
+* 10/18/26 - Created; ModuloHash, FibonacciHash, FastRangeHash and PowerOfTwoMaskHash
+*/
+
+#ifndef _HASH_POLICY
+#define _HASH_POLICY
+
+// Hash policies that BasicHashTable can be instantiated with
+enum HashPolicyKind { MODULO_HASH = 0, FIBONACCI_HASH = 1, FAST_RANGE_HASH = 2, POWER_OF_TWO_MASK_HASH = 3 };
+
+/**
+*
+* roundUpToPowerOfTwo
+*
+* function to return the smallest power of two that is >= requested (and at least 1)
+*
+* @param    requested   requested bucket count
+*
+* @return   power-of-two bucket count
+*/
+inline int roundUpToPowerOfTwo(int requested) {
+	int bucketCount = 1;
+	while (bucketCount < requested) {
+		bucketCount *= 2;
+	}
+	return bucketCount;
+}
+
+/**
+*
+* log2OfPowerOfTwo
+*
+* function to return log2 of a power of two
+*
+* @param    bucketCount     power-of-two bucket count
+*
+* @return   log2(bucketCount)
+*/
+inline int log2OfPowerOfTwo(int bucketCount) {
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_ctz((unsigned int)bucketCount);
+#else
+	int bits = 0;
+	while ((1 << bits) < bucketCount) {
+		bits++;
+	}
+	return bits;
+#endif
+}
+
+// A policy provides two static methods:
+//   bucketCountFor(requested)    the bucket count actually allocated for a requested size
+//   bucketOf(key, bucketCount)   the bucket of key, always in [0, bucketCount)
+// Bucket counts only ever double or halve after construction, so a power of two stays one.
+
+// key mod bucketCount, the original behaviour; negative keys are wrapped into range
+struct ModuloHash {
+	static int bucketCountFor(int requested) {
+		return requested;
+	}
+
+	static int bucketOf(int key, int bucketCount) {
+		int bucket = key % bucketCount;
+		return (bucket < 0) ? bucket + bucketCount : bucket;
+	}
+};
+
+// Multiply by 2^32 / golden ratio and keep the top log2(bucketCount) bits
+struct FibonacciHash {
+	static int bucketCountFor(int requested) {
+		return roundUpToPowerOfTwo(requested);
+	}
+
+	static int bucketOf(int key, int bucketCount) {
+		unsigned int product = (unsigned int)key * 2654435769u;
+		return (int)((unsigned long long)product >> (32 - log2OfPowerOfTwo(bucketCount)));
+	}
+};
+
+// Mix the key (murmur3 finalizer), then map it onto any bucket count with a multiply-high instead of a division
+struct FastRangeHash {
+	static int bucketCountFor(int requested) {
+		return requested;
+	}
+
+	static int bucketOf(int key, int bucketCount) {
+		unsigned int hash = (unsigned int)key;
+		hash ^= hash >> 16;
+		hash *= 0x85ebca6bu;
+		hash ^= hash >> 13;
+		hash *= 0xc2b2ae35u;
+		hash ^= hash >> 16;
+		return (int)(((unsigned long long)hash * (unsigned int)bucketCount) >> 32);
+	}
+};
+
+// Two multiply/xor-fold rounds so the low bits depend on the whole key, then keep the low bits with a mask
+struct PowerOfTwoMaskHash {
+	static int bucketCountFor(int requested) {
+		return roundUpToPowerOfTwo(requested);
+	}
+
+	static int bucketOf(int key, int bucketCount) {
+		unsigned int hash = (unsigned int)key * 0x9E3779B1u;
+		hash ^= hash >> 16;
+		hash *= 0x85ebca6bu;
+		hash ^= hash >> 13;
+		return (int)(hash & (unsigned int)(bucketCount - 1));
+	}
+};
+
+#endif
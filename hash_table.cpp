@@ -5,15 +5,324 @@
 *
 * 4/20/25 - Imported from Milestone 3
 * 5/7/25 - Modified to work without needing to include iostream in header file
+* 10/18/26 - Implements HashIndex: added destructor, add(int, DllNode*), getNode and getMemoryUsage
+* 10/18/26 - Added incremental resizing driven by MAX_LOAD_FACTOR / MIN_LOAD_FACTOR
+* 10/18/26 - Templated on HashPolicy; explicit instantiations for every policy at the end of the file
+* 10/18/26 - add, findOrInsert and remove walk the chain once; growth is checked before linking, so a
+*            table held at its size by a caller that adds then evicts does not grow
+* 10/18/26 - Added findOrAttach, detach and detachAll so CacheEntry chain links are never allocated or freed here
+* 10/18/26 - Allocations go through newObject/allocateArray with the table's memory resource
+* 10/18/26 - Added prefetch
+* 10/18/26 - Added getBytesPerItem
+* 10/18/26 - Lookups are const
 */
 
+#include <algorithm>
 #include <iostream>
 #include <string>
 #include "hash_table.h"
 
 extern void logToFileAndConsole(std::string msg);
 
-HashTable::HashTable() : numberOfBuckets(0), numberOfItems(0), table(nullptr) {}
+// Grow when items exceed MAX_LOAD_FACTOR per bucket, shrink when they drop below MIN_LOAD_FACTOR
+static const double MAX_LOAD_FACTOR = 1.0;
+static const double MIN_LOAD_FACTOR = 0.125;
+
+// While a resize is in progress each add/remove first clears CLEAR_BUCKETS_PER_STEP
+// buckets of the new table, then migrates MIGRATE_BUCKETS_PER_STEP non-empty old
+// buckets, visiting at most MAX_EMPTY_VISITS_PER_STEP empty ones
+static const int CLEAR_BUCKETS_PER_STEP = 1024;
+static const int MIGRATE_BUCKETS_PER_STEP = 4;
+static const int MAX_EMPTY_VISITS_PER_STEP = 40;
+
+template <class HashPolicy>
+BasicHashTable<HashPolicy>::BasicHashTable() : table(nullptr), numberOfItems(0), numberOfBuckets(0), oldTable(nullptr), oldNumberOfBuckets(0), rehashIndex(0), clearedBuckets(0), minimumBuckets(0), memoryResource(nullptr) {}
+
+template <class HashPolicy>
+BasicHashTable<HashPolicy>::~BasicHashTable() {
+    clear();
+    deallocateArray(memoryResource, table, numberOfBuckets);
+}
+
+/**
+*
+* calculateHashCode
+*
+* Method to calculate the bucket of currentKey in a table of bucketCount buckets
+*
+* @param    currentKey     key to hash
+* @param    bucketCount    number of buckets in the table
+*
+* @return   hashcode for currentKey
+*/
+template <class HashPolicy>
+int BasicHashTable<HashPolicy>::calculateHashCode(int currentKey, int bucketCount) const {
+    return HashPolicy::bucketOf(currentKey, bucketCount);
+}
+
+/**
+*
+* getBucket
+*
+* Method to return the bucket that holds (or would hold) curKey, in whichever table it currently lives
+*
+* @param    curKey  key to locate
+*
+* @return   pointer to the bucket head
+*/
+template <class HashPolicy>
+HashNode** BasicHashTable<HashPolicy>::getBucket(int curKey) const {
+    if (oldTable != nullptr) {
+        int oldHashCode = calculateHashCode(curKey, oldNumberOfBuckets);
+        if (oldHashCode >= rehashIndex) {
+            return &oldTable[oldHashCode];
+        }
+    }
+
+    return &table[calculateHashCode(curKey, numberOfBuckets)];
+}
+
+/**
+*
+* probe
+*
+* Method to advance any resize, then walk curKey's chain once; if curKey is absent and the
+* table is over its load factor, a resize is started first
+*
+* @param    curKey      key to look up
+* @param    existing    set to the chain node holding curKey, or nullptr if absent
+*
+* @return   the bucket a new node for curKey should be linked into
+*/
+template <class HashPolicy>
+HashNode** BasicHashTable<HashPolicy>::probe(int curKey, HashNode*& existing) {
+    migrateBuckets(MIGRATE_BUCKETS_PER_STEP);
+
+    HashNode** bucket = getBucket(curKey);
+
+    existing = *bucket;
+    while (existing != nullptr && existing->key != curKey) {
+        existing = existing->next;
+    }
+
+    if (existing == nullptr && oldTable == nullptr && numberOfItems > numberOfBuckets * MAX_LOAD_FACTOR) {
+        startResize(numberOfBuckets * 2);
+        bucket = getBucket(curKey);
+    }
+
+    return bucket;
+}
+
+/**
+*
+* linkAtHead
+*
+* Method to link a new chain node at the head of bucket
+*
+* @param    bucket    bucket returned by probe
+* @param    myNode    chain node to link
+*
+* @return   nothing
+*/
+template <class HashPolicy>
+void BasicHashTable<HashPolicy>::linkAtHead(HashNode** bucket, HashNode* myNode) {
+    myNode->hashCode = calculateHashCode(myNode->key);
+
+    // A recycled node may still carry links from an earlier bucket
+    myNode->prev = nullptr;
+    myNode->next = *bucket;
+    if (*bucket != nullptr) {
+        (*bucket)->prev = myNode;
+    }
+    *bucket = myNode;
+
+    numberOfItems++;
+}
+
+/**
+*
+* unlinkNode
+*
+* Method to find curKey's chain node and take it out of its bucket without deleting it
+*
+* @param    curKey  key of node to unlink
+*
+* @return   the unlinked chain node, or nullptr if curKey is absent
+*/
+template <class HashPolicy>
+HashNode* BasicHashTable<HashPolicy>::unlinkNode(int curKey) {
+    migrateBuckets(MIGRATE_BUCKETS_PER_STEP);
+
+    HashNode** bucket = getBucket(curKey);
+
+    HashNode* current = *bucket;
+    while (current != nullptr && current->key != curKey) {
+        current = current->next;
+    }
+
+    if (current == nullptr) {
+        return nullptr;
+    }
+
+    if (current->prev == nullptr) {
+        *bucket = current->next;
+        if (*bucket != nullptr) {
+            (*bucket)->prev = nullptr;
+        }
+    } else {
+        current->prev->next = current->next;
+        if (current->next != nullptr) {
+            current->next->prev = current->prev;
+        }
+    }
+
+    current->prev = nullptr;
+    current->next = nullptr;
+    numberOfItems--;
+
+    if (oldTable == nullptr && numberOfBuckets / 2 >= minimumBuckets && numberOfItems < numberOfBuckets * MIN_LOAD_FACTOR) {
+        startResize(numberOfBuckets / 2);
+    }
+
+    return current;
+}
+
+/**
+*
+* resetBuckets
+*
+* Method to empty every bucket without touching the chain nodes and drop back to the constructed size
+*
+* @param    none
+*
+* @return   nothing
+*/
+template <class HashPolicy>
+void BasicHashTable<HashPolicy>::resetBuckets() {
+    finishResize();
+
+    numberOfItems = 0;
+
+    // Drop back to the constructed size instead of keeping a grown, empty bucket array
+    if (numberOfBuckets != minimumBuckets) {
+        deallocateArray(memoryResource, table, numberOfBuckets);
+        table = allocateArray<HashNode*>(memoryResource, minimumBuckets);
+        numberOfBuckets = minimumBuckets;
+    }
+
+    for (int i = 0; i < numberOfBuckets; i++) {
+        table[i] = nullptr;
+    }
+}
+
+/**
+*
+* startResize
+*
+* Method to allocate a new bucket array and begin migrating chains into it
+*
+* @param    newNumberOfBuckets    size of the new bucket array
+*
+* @return   nothing
+*/
+template <class HashPolicy>
+void BasicHashTable<HashPolicy>::startResize(int newNumberOfBuckets) {
+    finishResize();
+
+    oldTable = table;
+    oldNumberOfBuckets = numberOfBuckets;
+    rehashIndex = 0;
+
+    // Left uninitialized here; migrateBuckets clears it a slice at a time
+    table = allocateArray<HashNode*>(memoryResource, newNumberOfBuckets);
+    numberOfBuckets = newNumberOfBuckets;
+    clearedBuckets = 0;
+}
+
+/**
+*
+* migrateBuckets
+*
+* Method to clear the next slice of the new table, or once it is cleared, move the chains
+* of up to bucketCount old buckets into it
+*
+* @param    bucketCount    maximum number of non-empty old buckets to migrate
+*
+* @return   nothing; frees the old table once it is drained
+*/
+template <class HashPolicy>
+void BasicHashTable<HashPolicy>::migrateBuckets(int bucketCount) {
+    if (oldTable == nullptr) {
+        return;
+    }
+
+    // Every key stays in oldTable (rehashIndex is 0) until the new table is fully cleared
+    if (clearedBuckets < numberOfBuckets) {
+        int end = std::min(numberOfBuckets, clearedBuckets + CLEAR_BUCKETS_PER_STEP);
+        for (int i = clearedBuckets; i < end; i++) {
+            table[i] = nullptr;
+        }
+        clearedBuckets = end;
+        return;
+    }
+
+    int emptyVisits = MAX_EMPTY_VISITS_PER_STEP;
+
+    while (bucketCount > 0 && rehashIndex < oldNumberOfBuckets) {
+        HashNode* current = oldTable[rehashIndex];
+
+        if (current == nullptr) {
+            rehashIndex++;
+            if (--emptyVisits == 0) {
+                break;
+            }
+            continue;
+        }
+
+        while (current != nullptr) {
+            HashNode* next = current->next;
+
+            int hashCode = calculateHashCode(current->key, numberOfBuckets);
+            current->hashCode = hashCode;
+            current->prev = nullptr;
+            current->next = table[hashCode];
+            if (table[hashCode] != nullptr) {
+                table[hashCode]->prev = current;
+            }
+            table[hashCode] = current;
+
+            current = next;
+        }
+
+        oldTable[rehashIndex] = nullptr;
+        rehashIndex++;
+        bucketCount--;
+    }
+
+    if (rehashIndex >= oldNumberOfBuckets) {
+        deallocateArray(memoryResource, oldTable, oldNumberOfBuckets);
+        oldTable = nullptr;
+        oldNumberOfBuckets = 0;
+        rehashIndex = 0;
+    }
+}
+
+/**
+*
+* finishResize
+*
+* Method to migrate every remaining old bucket
+*
+* @param    none
+*
+* @return   nothing
+*/
+template <class HashPolicy>
+void BasicHashTable<HashPolicy>::finishResize() {
+    while (oldTable != nullptr) {
+        migrateBuckets(oldNumberOfBuckets);
+    }
+}
 
 /**
 *
@@ -25,7 +334,8 @@ HashTable::HashTable() : numberOfBuckets(0), numberOfItems(0), table(nullptr) {}
 *
 * @return   pointer to the hash table array
 */
-HashNode** HashTable::getTable() {
+template <class HashPolicy>
+HashNode** BasicHashTable<HashPolicy>::getTable() {
     return table;
 }
 
@@ -39,7 +349,8 @@ HashNode** HashTable::getTable() {
 *
 * @return	size of the hash table array
 */
-int HashTable::getSize() {
+template <class HashPolicy>
+int BasicHashTable<HashPolicy>::getSize() {
     return numberOfBuckets;
 }
 
@@ -53,21 +364,38 @@ int HashTable::getSize() {
 *
 * @return   hashcode for currentKey
 */
-int HashTable::calculateHashCode(int currentKey) {
-    return currentKey % numberOfBuckets;
+template <class HashPolicy>
+int BasicHashTable<HashPolicy>::calculateHashCode(int currentKey) {
+    return calculateHashCode(currentKey, numberOfBuckets);
+}
+
+/**
+*
+* isResizing
+*
+* Method to check if an incremental resize is in progress
+*
+* @param    none
+*
+* @return   true if chains are still being migrated to a new bucket array
+*/
+template <class HashPolicy>
+bool BasicHashTable<HashPolicy>::isResizing() {
+    return oldTable != nullptr;
 }
 
 /**
 *
 * isEmpty
 *
-* Method to check if HashTable is empty
+* Method to check if the hash table is empty
 *
 * @param    none
 *
 * @return   true if the table has zero entries, false otherwise
 */
-bool HashTable::isEmpty() {
+template <class HashPolicy>
+bool BasicHashTable<HashPolicy>::isEmpty() {
     return numberOfItems == 0;
 }
 
@@ -81,7 +409,8 @@ bool HashTable::isEmpty() {
 *
 * @return   number of items in the table
 */
-int HashTable::getNumberOfItems() {
+template <class HashPolicy>
+int BasicHashTable<HashPolicy>::getNumberOfItems() {
     return numberOfItems;
 }
 
@@ -89,31 +418,104 @@ int HashTable::getNumberOfItems() {
 *
 * add
 *
-* Method to add a node to the hash table
+* Method to add a node to the hash table; the table frees it on remove, so it must come from
+* the table's memory resource (or new, if the table has none)
 *
 * @param    curKey    key for this node
 * @param    myNode    new node to add to the table
 *
 * @return   true if success, false otherwise
 */
-bool HashTable::add(int curKey, HashNode* myNode) {
-    int hashCode = calculateHashCode(curKey);
-    myNode->hashCode = hashCode;
+template <class HashPolicy>
+bool BasicHashTable<HashPolicy>::add(int curKey, HashNode* myNode) {
+    HashNode* existing;
+    HashNode** bucket = probe(curKey, existing);
 
-    if (contains(curKey)) {
+    if (existing != nullptr) {
         return false;
     }
 
-    if (table[hashCode] == nullptr) {
-        table[hashCode] = myNode;
-    } else {
-        myNode->next = table[hashCode];
-        table[hashCode]->prev = myNode;
-        table[hashCode] = myNode;
+    linkAtHead(bucket, myNode);
+    return true;
+}
+
+/**
+*
+* add
+*
+* Method to add a FIFO node to the hash table, allocating the chain node for it
+*
+* @param    curKey    key for this node
+* @param    myNode    FIFO node the key refers to
+*
+* @return   true if success, false otherwise
+*/
+template <class HashPolicy>
+bool BasicHashTable<HashPolicy>::add(int curKey, DllNode* myNode) {
+    bool inserted;
+    findOrInsert(curKey, myNode, inserted);
+
+    return inserted;
+}
+
+/**
+*
+* findOrInsert
+*
+* Method to look up curKey and, if it is absent, map it to myNode, walking the chain once
+*
+* @param    curKey      key to look up or insert
+* @param    myNode      FIFO node to map curKey to if it is absent
+* @param    inserted    set to true if curKey was inserted, false if it was already present
+*
+* @return   the chain node's FIFO node pointer for curKey
+*/
+template <class HashPolicy>
+DllNode** BasicHashTable<HashPolicy>::findOrInsert(int curKey, DllNode* myNode, bool& inserted) {
+    HashNode* existing;
+    HashNode** bucket = probe(curKey, existing);
+
+    if (existing != nullptr) {
+        inserted = false;
+        return &existing->fifoNode;
     }
 
-    numberOfItems++;
-    return true;
+    HashNode* newHashNode = newObject<HashNode>(memoryResource, curKey, myNode);
+    linkAtHead(bucket, newHashNode);
+
+    inserted = true;
+    return &newHashNode->fifoNode;
+}
+
+/**
+*
+* findOrAttach
+*
+* Method to look up curKey and, if it is absent, link entry->hashLinks into its bucket
+*
+* @param    curKey      key to look up or insert
+* @param    entry       cache entry to map curKey to if it is absent
+* @param    inserted    set to true if curKey was inserted, false if it was already present
+*
+* @return   the chain node's FIFO node pointer for curKey
+*/
+template <class HashPolicy>
+DllNode** BasicHashTable<HashPolicy>::findOrAttach(int curKey, CacheEntry* entry, bool& inserted) {
+    HashNode* existing;
+    HashNode** bucket = probe(curKey, existing);
+
+    if (existing != nullptr) {
+        inserted = false;
+        return &existing->fifoNode;
+    }
+
+    HashNode* links = &entry->hashLinks;
+    links->key = curKey;
+    links->fifoNode = entry;
+    linkAtHead(bucket, links);
+
+    inserted = true;
+    return &links->fifoNode;
 }
 
 /**
@@ -126,36 +528,59 @@ bool HashTable::add(int curKey, HashNode* myNode) {
 *
 * @return   true if success, false otherwise
 */
-bool HashTable::remove(int curKey) {
-    if (!contains(curKey)) {
+template <class HashPolicy>
+bool BasicHashTable<HashPolicy>::remove(int curKey) {
+    DllNode* removedNode;
+
+    return remove(curKey, removedNode);
+}
+
+/**
+*
+* remove
+*
+* Method to remove node with curKey and hand back its FIFO node
+*
+* @param    curKey          key of node to remove
+* @param    removedNode     set to the FIFO node of the removed chain node
+*
+* @return   true if success, false otherwise
+*/
+template <class HashPolicy>
+bool BasicHashTable<HashPolicy>::remove(int curKey, DllNode*& removedNode) {
+    HashNode* current = unlinkNode(curKey);
+
+    if (current == nullptr) {
         return false;
     }
 
-    int hashCode = calculateHashCode(curKey);
+    removedNode = current->fifoNode;
+    deleteObject(memoryResource, current);
 
-    HashNode* current = table[hashCode];
-    while (current != nullptr && current->key != curKey) {
-        current = current->next;
-    }
+    return true;
+}
+
+/**
+*
+* detach
+*
+* Method to unlink the entry with curKey without deleting its chain node
+*
+* @param    curKey          key of entry to remove
+* @param    removedNode     set to the FIFO node of the unlinked chain node
+*
+* @return   true if success, false otherwise
+*/
+template <class HashPolicy>
+bool BasicHashTable<HashPolicy>::detach(int curKey, DllNode*& removedNode) {
+    HashNode* current = unlinkNode(curKey);
 
     if (current == nullptr) {
         return false;
     }
 
-    if (current->prev == nullptr) {
-        table[hashCode] = current->next;
-        if (table[hashCode] != nullptr) {
-            table[hashCode]->prev = nullptr;
-        }
-    } else {
-        current->prev->next = current->next;
-        if (current->next != nullptr) {
-            current->next->prev = current->prev;
-        }
-    }
+    removedNode = current->fifoNode;
 
-    delete current;
-    numberOfItems--;
     return true;
 }
 
@@ -169,20 +594,36 @@ bool HashTable::remove(int curKey) {
 *
 * @return   nothing, but will delete all entries from the table
 */
-void HashTable::clear() {
+template <class HashPolicy>
+void BasicHashTable<HashPolicy>::clear() {
+    finishResize();
+
     for (int i = 0; i < numberOfBuckets; i++) {
         HashNode* current = table[i];
 
         while (current != nullptr) {
             HashNode* temp = current;
             current = current->next;
-            delete temp;
+            deleteObject(memoryResource, temp);
         }
-
-        table[i] = nullptr;
     }
 
-    numberOfItems = 0;
+    resetBuckets();
+}
+
+/**
+*
+* detachAll
+*
+* Method to empty the table without deleting any chain node; used when every node is a CacheEntry's hashLinks
+*
+* @param    none
+*
+* @return   nothing
+*/
+template <class HashPolicy>
+void BasicHashTable<HashPolicy>::detachAll() {
+    resetBuckets();
 }
 
 /**
@@ -193,12 +634,28 @@ void HashTable::clear() {
 *
 * @param    curKey  retrieve node from hash table with curKey value
 *
-* @return   pointer to the HashNode
+* @return   pointer to the DllNode, or nullptr if not found
 */
-HashNode* HashTable::getItem(int curKey) {
-    int hashCode = calculateHashCode(curKey);
+template <class HashPolicy>
+DllNode* BasicHashTable<HashPolicy>::getItem(int curKey) const {
+    HashNode* hashNode = getNode(curKey);
 
-    HashNode* current = table[hashCode];
+    return (hashNode == nullptr) ? nullptr : hashNode->getFifoNode();
+}
+
+/**
+*
+* getNode
+*
+* Method to retrieve the chain node from the hash table
+*
+* @param    curKey  retrieve node from hash table with curKey value
+*
+* @return   pointer to the HashNode, or nullptr if not found
+*/
+template <class HashPolicy>
+HashNode* BasicHashTable<HashPolicy>::getNode(int curKey) const {
+    HashNode* current = *getBucket(curKey);
     while (current != nullptr && current->key != curKey) {
         current = current->next;
     }
@@ -216,10 +673,9 @@ HashNode* HashTable::getItem(int curKey) {
 *
 * @return   true if found, false otherwise
 */
-bool HashTable::contains(int curKey) {
-    int hashCode = calculateHashCode(curKey);
-
-    HashNode* current = table[hashCode];
+template <class HashPolicy>
+bool BasicHashTable<HashPolicy>::contains(int curKey) const {
+    HashNode* current = *getBucket(curKey);
     while (current != nullptr) {
         if (current->key == curKey) {
             return true;
@@ -230,6 +686,52 @@ bool HashTable::contains(int curKey) {
     return false;
 }
 
+/**
+*
+* prefetch
+*
+* Method to start loading the bucket curKey hashes to
+*
+* @param    curKey  key that will be looked up soon
+*
+* @return   nothing
+*/
+template <class HashPolicy>
+void BasicHashTable<HashPolicy>::prefetch(int curKey) const {
+    prefetchForRead(getBucket(curKey));
+}
+
+/**
+*
+* getMemoryUsage
+*
+* Method to return the bytes held by the bucket array and chain nodes
+*
+* @param    none
+*
+* @return   bytes used by the hash table
+*/
+template <class HashPolicy>
+size_t BasicHashTable<HashPolicy>::getMemoryUsage() {
+    return sizeof(BasicHashTable) + (numberOfBuckets + oldNumberOfBuckets) * sizeof(HashNode*) + numberOfItems * sizeof(HashNode);
+}
+
+/**
+*
+* getBytesPerItem
+*
+* Method to return the index storage one item accounts for at the maximum load factor
+*
+* @param    none
+*
+* @return   bytes per item
+*/
+template <class HashPolicy>
+size_t BasicHashTable<HashPolicy>::getBytesPerItem() {
+    // One bucket pointer per MAX_LOAD_FACTOR items; a CacheEntry carries its own chain node
+    return (size_t)(sizeof(HashNode*) / MAX_LOAD_FACTOR);
+}
+
 /**
 *
 * printTable
@@ -240,7 +742,10 @@ bool HashTable::contains(int curKey) {
 *
 * @return   nothing, but output is sent to console and to file
 */
-void HashTable::printTable() {
+template <class HashPolicy>
+void BasicHashTable<HashPolicy>::printTable() {
+    finishResize();
+
     for (int i = 0; i < numberOfBuckets; i++) {
         if (table[i] == nullptr) {
             logToFileAndConsole("Empty bucket: " + std::to_string(i));
@@ -258,4 +763,9 @@ void HashTable::printTable() {
             }
         }
     }
-}
\ No newline at end of file
+}
+
+template class BasicHashTable<ModuloHash>;
+template class BasicHashTable<FibonacciHash>;
+template class BasicHashTable<FastRangeHash>;
+template class BasicHashTable<PowerOfTwoMaskHash>;
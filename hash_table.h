@@ -1,174 +1,468 @@
-/**
-*
-* hash_table.hpp : This is the header file for hash_table.cpp.
-*
-* 09/23/24 - Created by ChatGPT
-* 10/17/24 - Modified by jhui
-* 01/11/25 - Modified by hhui; 1) added calculateHashCode, 2) modified methods to include hash table size parameter
-* 01/16/2025 - Modified by hhui; created separate node structure file
-*/
-
-#ifndef _HASH_TABLE
-#define _HASH_TABLE
-
-#include "hash_node.h"
-
-// Define a class for the hash table 
-class HashTable {
-private:
-	HashNode** table;
-	int numberOfItems;
-	int numberOfBuckets;
-
-public:
-	// Default constructor
-	HashTable();
-	
-	// Constructor initializes an empty list
-	HashTable(int hashTableSize) : numberOfBuckets(hashTableSize), numberOfItems(0) {
-		table = new HashNode * [hashTableSize];
-		std::cout << "hashTableSize: " << hashTableSize << std::endl;
-		for (int i = 0; i < hashTableSize; i++) {
-			table[i] = nullptr;
-		}
-	}
-
-	/**
-	*
-	* getTable
-	*
-	* Method to return the hash table
-	*
-	* @param    none
-	*
-	* @return   pointer to the hash table array
-	*/
-	HashNode** getTable();
-
-	/**
-	*
-	* getSize
-	*
-	* Method to return the size of the hash table
-	*
-	* @param    none
-	*
-	* @return	size of the hash table array
-	*/
-	int getSize();
-
-	/**
-	*
-	* calculateHashCode
-	*
-	* Method to calculate the hashCode
-	*
-	* @param    currentKey     hash table size
-	*
-	* @return   hashcode for currentKey
-	*/	int calculateHashCode(int currentKey);
-
-	/**
-	*
-	* isEmpty
-	*
-	* Method to check if HashTable is empty
-	*
-	* @param    none
-	*
-	* @return   true if the table has zero entries, false otherwise
-	*/
-	bool isEmpty();
-
-	/**
-	*
-	* getNumberOfItems
-	*
-	* Method to return number of items in the hash table
-	*
-	* @param    none
-	*
-	* @return   number of items in the table
-	*/
-	int getNumberOfItems();
-
-	/**
-	*
-	* add
-	*
-	* Method to add a node to the hash table
-	*
-	* @param    curKey    key for this node
-	* @param    myNode    new node to add to the table
-	*
-	* @return   true if success, false otherwise
-	*/
-	bool add(int curKey, HashNode* myNode);
-
-	/**
-	*
-	* remove
-	*
-	* Method to remove node with curKey
-	*
-	* @param    key     key of node to remove
-	*
-	* @return   true if success, false otherwise
-	*/
-	bool remove(int curKey);
-
-	/**
-	*
-	* clear
-	*
-	* Method to remove all entries from the table
-	*
-	* @param    none
-	*
-	* @return   nothing, but will delete all entries from the table
-	*/
-	void clear();
-
-	/**
-	*
-	* getItem
-	*
-	* Method to retrieve item from the hash table
-	*
-	* @param    curKey  retrieve node from hash table with curKey value
-	*
-	* @return   pointer to the HashNode
-	*/
-	HashNode* getItem(int curKey);
-
-
-	/**
-	*
-	* contains
-	*
-	* Method to verify if a key is in the hash table
-	*
-	* @param    curKey  check key for hash table with curKey value
-	*
-	* @return   true if found, false otherwise
-	*/
-	bool contains(int curKey);
-
-	/**
-	*
-	* printTable
-	*
-	* Method to print out the contents of table
-	*
-	* @param    none
-	*
-	* @return   nothing, but output is sent to console and to file
-	*/
-	void printTable();
-
-
-}; // end HashTable
-
-
-
+/**
+*
+* hash_table.hpp : This is the header file for hash_table.cpp.
+*
+* 09/23/24 - Created by ChatGPT
+* 10/17/24 - Modified by jhui
+* 01/11/25 - Modified by hhui; 1) added calculateHashCode, 2) modified methods to include hash table size parameter
+* 01/16/2025 - Modified by hhui; created separate node structure file
+* 10/18/26 - Implements HashIndex; getItem now returns the FIFO node, getNode returns the chain node
+* 10/18/26 - Added load-factor-driven growth and shrinkage with incremental bucket migration
+* 10/18/26 - Now BasicHashTable<HashPolicy>; HashTable is the ModuloHash instantiation
+* 10/18/26 - Added findOrInsert and remove(curKey, removedNode); adds walk the chain once
+* 10/18/26 - Added findOrAttach, detach and detachAll; CacheEntry chain links are linked in place
+* 10/18/26 - Bucket arrays and chain nodes come from an optional std::pmr::memory_resource
+* 10/18/26 - Added prefetch
+* 10/18/26 - Added getBytesPerItem
+* 10/18/26 - Lookups are const
+*/
+
+#ifndef _HASH_TABLE
+#define _HASH_TABLE
+
+#include "hash_index.h"
+#include "hash_node.h"
+#include "hash_policy.h"
+#include "memory_resources.h"
+
+// Define a class for the hash table 
+//
+// The table grows when the load factor passes MAX_LOAD_FACTOR and shrinks (never
+// below the constructed size) when it drops under MIN_LOAD_FACTOR. A resize only
+// allocates the new bucket array; each add and remove then clears a slice of it
+// and, once it is fully cleared, moves a few old chains across, so no single
+// operation pays for the whole rehash. While a resize is in progress a key lives
+// in oldTable if its old bucket has not been migrated yet, and in table otherwise.
+//
+// HashPolicy (see hash_policy.h) picks the bucket of a key at compile time. The
+// member functions are defined in hash_table.cpp and instantiated there for each
+// policy.
+template <class HashPolicy>
+class BasicHashTable : public HashIndex {
+private:
+	HashNode** table;
+	int numberOfItems;
+	int numberOfBuckets;
+
+	HashNode** oldTable;			// buckets still being drained by an incremental resize, nullptr otherwise
+	int oldNumberOfBuckets;
+	int rehashIndex;				// next oldTable bucket to migrate
+	int clearedBuckets;				// buckets of a freshly allocated table that have been set to nullptr
+	int minimumBuckets;				// the table never shrinks below its constructed size
+
+	std::pmr::memory_resource* memoryResource;	// source of bucket arrays and chain nodes; nullptr = new/delete
+
+	/**
+	*
+	* calculateHashCode
+	*
+	* Method to calculate the bucket of currentKey in a table of bucketCount buckets
+	*
+	* @param    currentKey     key to hash
+	* @param    bucketCount    number of buckets in the table
+	*
+	* @return   hashcode for currentKey
+	*/
+	int calculateHashCode(int currentKey, int bucketCount) const;
+
+	/**
+	*
+	* getBucket
+	*
+	* Method to return the bucket that holds (or would hold) curKey, in whichever table it currently lives
+	*
+	* @param    curKey  key to locate
+	*
+	* @return   pointer to the bucket head
+	*/
+	HashNode** getBucket(int curKey) const;
+
+	/**
+	*
+	* probe
+	*
+	* Method to advance any resize, then walk curKey's chain once; if curKey is absent and the
+	* table is over its load factor, a resize is started first
+	*
+	* @param    curKey      key to look up
+	* @param    existing    set to the chain node holding curKey, or nullptr if absent
+	*
+	* @return   the bucket a new node for curKey should be linked into
+	*/
+	HashNode** probe(int curKey, HashNode*& existing);
+
+	/**
+	*
+	* linkAtHead
+	*
+	* Method to link a new chain node at the head of bucket
+	*
+	* @param    bucket    bucket returned by probe
+	* @param    myNode    chain node to link
+	*
+	* @return   nothing
+	*/
+	void linkAtHead(HashNode** bucket, HashNode* myNode);
+
+	/**
+	*
+	* unlinkNode
+	*
+	* Method to find curKey's chain node and take it out of its bucket without deleting it
+	*
+	* @param    curKey  key of node to unlink
+	*
+	* @return   the unlinked chain node, or nullptr if curKey is absent
+	*/
+	HashNode* unlinkNode(int curKey);
+
+	/**
+	*
+	* resetBuckets
+	*
+	* Method to empty every bucket without touching the chain nodes and drop back to the constructed size
+	*
+	* @param    none
+	*
+	* @return   nothing
+	*/
+	void resetBuckets();
+
+	/**
+	*
+	* startResize
+	*
+	* Method to allocate a new bucket array and begin migrating chains into it
+	*
+	* @param    newNumberOfBuckets    size of the new bucket array
+	*
+	* @return   nothing
+	*/
+	void startResize(int newNumberOfBuckets);
+
+	/**
+	*
+	* migrateBuckets
+	*
+	* Method to clear the next slice of the new table, or once it is cleared, move the chains
+	* of up to bucketCount old buckets into it
+	*
+	* @param    bucketCount    maximum number of non-empty old buckets to migrate
+	*
+	* @return   nothing; frees the old table once it is drained
+	*/
+	void migrateBuckets(int bucketCount);
+
+	/**
+	*
+	* finishResize
+	*
+	* Method to migrate every remaining old bucket
+	*
+	* @param    none
+	*
+	* @return   nothing
+	*/
+	void finishResize();
+
+public:
+	// Default constructor
+	BasicHashTable();
+	
+	// Constructor initializes an empty list; the policy may round the bucket count up. Bucket arrays
+	// and the chain nodes the table allocates itself come from resource (new/delete if null).
+	BasicHashTable(int hashTableSize, std::pmr::memory_resource* resource = nullptr) : numberOfItems(0), numberOfBuckets(HashPolicy::bucketCountFor(hashTableSize)), oldTable(nullptr), oldNumberOfBuckets(0), rehashIndex(0), memoryResource(resource) {
+		clearedBuckets = numberOfBuckets;
+		minimumBuckets = numberOfBuckets;
+		table = allocateArray<HashNode*>(memoryResource, numberOfBuckets);
+		std::cout << "hashTableSize: " << hashTableSize << std::endl;
+		for (int i = 0; i < numberOfBuckets; i++) {
+			table[i] = nullptr;
+		}
+	}
+
+	// Destructor deletes all chain nodes and the bucket array
+	~BasicHashTable();
+
+	/**
+	*
+	* getTable
+	*
+	* Method to return the hash table
+	*
+	* @param    none
+	*
+	* @return   pointer to the hash table array
+	*/
+	HashNode** getTable();
+
+	/**
+	*
+	* getSize
+	*
+	* Method to return the size of the hash table
+	*
+	* @param    none
+	*
+	* @return	size of the hash table array
+	*/
+	int getSize();
+
+	/**
+	*
+	* calculateHashCode
+	*
+	* Method to calculate the hashCode
+	*
+	* @param    currentKey     hash table size
+	*
+	* @return   hashcode for currentKey
+	*/	int calculateHashCode(int currentKey);
+
+	/**
+	*
+	* isResizing
+	*
+	* Method to check if an incremental resize is in progress
+	*
+	* @param    none
+	*
+	* @return   true if chains are still being migrated to a new bucket array
+	*/
+	bool isResizing();
+
+	/**
+	*
+	* isEmpty
+	*
+	* Method to check if the hash table is empty
+	*
+	* @param    none
+	*
+	* @return   true if the table has zero entries, false otherwise
+	*/
+	bool isEmpty();
+
+	/**
+	*
+	* getNumberOfItems
+	*
+	* Method to return number of items in the hash table
+	*
+	* @param    none
+	*
+	* @return   number of items in the table
+	*/
+	int getNumberOfItems();
+
+	/**
+	*
+	* add
+	*
+	* Method to add a node to the hash table; the table frees it on remove, so it must come from
+	* the table's memory resource (or new, if the table has none)
+	*
+	* @param    curKey    key for this node
+	* @param    myNode    new node to add to the table
+	*
+	* @return   true if success, false otherwise
+	*/
+	bool add(int curKey, HashNode* myNode);
+
+	/**
+	*
+	* add
+	*
+	* Method to add a FIFO node to the hash table, allocating the chain node for it
+	*
+	* @param    curKey    key for this node
+	* @param    myNode    FIFO node the key refers to
+	*
+	* @return   true if success, false otherwise
+	*/
+	bool add(int curKey, DllNode* myNode);
+
+	/**
+	*
+	* findOrInsert
+	*
+	* Method to look up curKey and, if it is absent, map it to myNode, walking the chain once
+	*
+	* @param    curKey      key to look up or insert
+	* @param    myNode      FIFO node to map curKey to if it is absent
+	* @param    inserted    set to true if curKey was inserted, false if it was already present
+	*
+	* @return   the chain node's FIFO node pointer for curKey
+	*/
+	DllNode** findOrInsert(int curKey, DllNode* myNode, bool& inserted);
+
+	/**
+	*
+	* findOrAttach
+	*
+	* Method to look up curKey and, if it is absent, link entry->hashLinks into its bucket
+	*
+	* @param    curKey      key to look up or insert
+	* @param    entry       cache entry to map curKey to if it is absent
+	* @param    inserted    set to true if curKey was inserted, false if it was already present
+	*
+	* @return   the chain node's FIFO node pointer for curKey
+	*/
+	DllNode** findOrAttach(int curKey, CacheEntry* entry, bool& inserted);
+
+	/**
+	*
+	* remove
+	*
+	* Method to remove node with curKey
+	*
+	* @param    key     key of node to remove
+	*
+	* @return   true if success, false otherwise
+	*/
+	bool remove(int curKey);
+
+	/**
+	*
+	* remove
+	*
+	* Method to remove node with curKey and hand back its FIFO node
+	*
+	* @param    curKey          key of node to remove
+	* @param    removedNode     set to the FIFO node of the removed chain node
+	*
+	* @return   true if success, false otherwise
+	*/
+	bool remove(int curKey, DllNode*& removedNode);
+
+	/**
+	*
+	* detach
+	*
+	* Method to unlink the entry with curKey without deleting its chain node
+	*
+	* @param    curKey          key of entry to remove
+	* @param    removedNode     set to the FIFO node of the unlinked chain node
+	*
+	* @return   true if success, false otherwise
+	*/
+	bool detach(int curKey, DllNode*& removedNode);
+
+	/**
+	*
+	* clear
+	*
+	* Method to remove all entries from the table
+	*
+	* @param    none
+	*
+	* @return   nothing, but will delete all entries from the table
+	*/
+	void clear();
+
+	/**
+	*
+	* detachAll
+	*
+	* Method to empty the table without deleting any chain node; used when every node is a CacheEntry's hashLinks
+	*
+	* @param    none
+	*
+	* @return   nothing
+	*/
+	void detachAll();
+
+	/**
+	*
+	* getItem
+	*
+	* Method to retrieve item from the hash table
+	*
+	* @param    curKey  retrieve node from hash table with curKey value
+	*
+	* @return   pointer to the DllNode, or nullptr if not found
+	*/
+	DllNode* getItem(int curKey) const;
+
+	/**
+	*
+	* getNode
+	*
+	* Method to retrieve the chain node from the hash table
+	*
+	* @param    curKey  retrieve node from hash table with curKey value
+	*
+	* @return   pointer to the HashNode, or nullptr if not found
+	*/
+	HashNode* getNode(int curKey) const;
+
+
+	/**
+	*
+	* contains
+	*
+	* Method to verify if a key is in the hash table
+	*
+	* @param    curKey  check key for hash table with curKey value
+	*
+	* @return   true if found, false otherwise
+	*/
+	bool contains(int curKey) const;
+
+	/**
+	*
+	* prefetch
+	*
+	* Method to start loading the bucket curKey hashes to
+	*
+	* @param    curKey  key that will be looked up soon
+	*
+	* @return   nothing
+	*/
+	void prefetch(int curKey) const;
+
+	/**
+	*
+	* getMemoryUsage
+	*
+	* Method to return the bytes held by the bucket array and chain nodes
+	*
+	* @param    none
+	*
+	* @return   bytes used by the hash table
+	*/
+	size_t getMemoryUsage();
+
+	/**
+	*
+	* getBytesPerItem
+	*
+	* Method to return the index storage one item accounts for at the maximum load factor
+	*
+	* @param    none
+	*
+	* @return   bytes per item
+	*/
+	size_t getBytesPerItem();
+
+	/**
+	*
+	* printTable
+	*
+	* Method to print out the contents of table
+	*
+	* @param    none
+	*
+	* @return   nothing, but output is sent to console and to file
+	*/
+	void printTable();
+
+
+}; // end BasicHashTable
+
+// The original key % numberOfBuckets table
+typedef BasicHashTable<ModuloHash> HashTable;
+
+
+
 #endif 
\ No newline at end of file
@@ -0,0 +1,188 @@
+/**
+*
+* @file memory_resources.cpp - Implementation of HugePageResource and createMemoryResource
+*
+* 10/18/26 - Created
+*/
+
+#include "memory_resources.h"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+/**
+*
+* getMappedBytes
+*
+* Method to return the bytes currently mapped by this resource
+*
+* @param    none
+*
+* @return   mapped bytes
+*/
+std::size_t HugePageResource::getMappedBytes() const {
+    return mappedBytes;
+}
+
+/**
+*
+* do_allocate
+*
+* Method to map bytes rounded up to whole huge pages; alignment up to a huge page is always met
+*
+* @param    bytes       requested size
+* @param    alignment   requested alignment
+*
+* @return   the mapped memory; throws std::bad_alloc if nothing can be mapped
+*/
+void* HugePageResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+#if defined(__linux__)
+    (void)alignment;    // mmap returns page-aligned memory
+    std::size_t mappedSize = (bytes + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+
+    void* memory = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (memory == MAP_FAILED) {
+        memory = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memory == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+#if defined(MADV_HUGEPAGE)
+        madvise(memory, mappedSize, MADV_HUGEPAGE);
+#endif
+    }
+
+    mappedBytes += mappedSize;
+    return memory;
+#else
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+#endif
+}
+
+/**
+*
+* do_deallocate
+*
+* Method to unmap memory returned by do_allocate
+*
+* @param    memory      memory to unmap
+* @param    bytes       size it was allocated with
+* @param    alignment   alignment it was allocated with
+*
+* @return   nothing
+*/
+void HugePageResource::do_deallocate(void* memory, std::size_t bytes, std::size_t alignment) {
+#if defined(__linux__)
+    (void)alignment;
+    std::size_t mappedSize = (bytes + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+
+    munmap(memory, mappedSize);
+    mappedBytes -= mappedSize;
+#else
+    std::pmr::new_delete_resource()->deallocate(memory, bytes, alignment);
+#endif
+}
+
+/**
+*
+* do_is_equal
+*
+* Method to check if memory from this resource can be freed by other
+*
+* @param    other   resource to compare with
+*
+* @return   true only for the same object
+*/
+bool HugePageResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+HugePagePoolResource::HugePagePoolResource() : arena(HugePageResource::HUGE_PAGE_SIZE, hugePageResource()), pools(&arena) {}
+
+/**
+*
+* do_allocate
+*
+* Method to allocate from the size-class pools
+*
+* @param    bytes       requested size
+* @param    alignment   requested alignment
+*
+* @return   the allocated memory
+*/
+void* HugePagePoolResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+    return pools.allocate(bytes, alignment);
+}
+
+/**
+*
+* do_deallocate
+*
+* Method to return memory to the size-class pools
+*
+* @param    memory      memory to free
+* @param    bytes       size it was allocated with
+* @param    alignment   alignment it was allocated with
+*
+* @return   nothing
+*/
+void HugePagePoolResource::do_deallocate(void* memory, std::size_t bytes, std::size_t alignment) {
+    pools.deallocate(memory, bytes, alignment);
+}
+
+/**
+*
+* do_is_equal
+*
+* Method to check if memory from this resource can be freed by other
+*
+* @param    other   resource to compare with
+*
+* @return   true only for the same object
+*/
+bool HugePagePoolResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+/**
+*
+* hugePageResource
+*
+* function to return the process-wide HugePageResource
+*
+* @param    none
+*
+* @return   the shared huge page resource
+*/
+HugePageResource* hugePageResource() {
+    static HugePageResource resource;
+    return &resource;
+}
+
+/**
+*
+* createMemoryResource
+*
+* function to build a resource of the given kind; the caller deletes it after every structure using it
+*
+* @param    kind    DEFAULT_RESOURCE returns nullptr (plain new/delete); MONOTONIC_RESOURCE an arena
+*                   that frees nothing until it is destroyed; POOL_RESOURCE size-class pools over
+*                   new/delete; HUGE_PAGE_RESOURCE the same pools backed by huge pages
+*
+* @return   the new resource, or nullptr for DEFAULT_RESOURCE
+*/
+std::pmr::memory_resource* createMemoryResource(MemoryResourceKind kind) {
+    if (kind == MONOTONIC_RESOURCE) {
+        return new std::pmr::monotonic_buffer_resource();
+    }
+
+    if (kind == POOL_RESOURCE) {
+        return new std::pmr::unsynchronized_pool_resource();
+    }
+
+    if (kind == HUGE_PAGE_RESOURCE) {
+        return new HugePagePoolResource();
+    }
+
+    return nullptr;
+}
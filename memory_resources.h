@@ -0,0 +1,186 @@
+/**
+*
+* memory_resources.h : Memory resource helpers shared by the cache structures.
+*
+* 10/18/26 - Created; newObject/deleteObject, allocateArray/deallocateArray, HugePageResource, HugePagePoolResource
+*            and createMemoryResource
+*/
+
+#ifndef _MEMORY_RESOURCES
+#define _MEMORY_RESOURCES
+
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <utility>
+
+// Memory resources that createMemoryResource can build
+enum MemoryResourceKind { DEFAULT_RESOURCE = 0, MONOTONIC_RESOURCE = 1, POOL_RESOURCE = 2, HUGE_PAGE_RESOURCE = 3 };
+
+// Every structure that allocates takes an optional std::pmr::memory_resource*. A null
+// resource means plain new/delete, so code that never injects one behaves exactly as
+// before; the helpers below hide the difference.
+
+/**
+*
+* newObject
+*
+* function to construct a T in memory from resource, or with new if resource is null
+*
+* @param    resource    memory resource, or nullptr
+* @param    args        constructor arguments
+*
+* @return   the new object
+*/
+template <class T, class... Args>
+T* newObject(std::pmr::memory_resource* resource, Args&&... args) {
+	if (resource == nullptr) {
+		return new T(std::forward<Args>(args)...);
+	}
+
+	void* memory = resource->allocate(sizeof(T), alignof(T));
+	return new (memory) T(std::forward<Args>(args)...);
+}
+
+/**
+*
+* deleteObject
+*
+* function to destroy an object made by newObject with the same resource
+*
+* @param    resource    memory resource the object came from, or nullptr
+* @param    object      object to destroy
+*
+* @return   nothing
+*/
+template <class T>
+void deleteObject(std::pmr::memory_resource* resource, T* object) {
+	if (resource == nullptr) {
+		delete object;
+		return;
+	}
+
+	object->~T();
+	resource->deallocate(object, sizeof(T), alignof(T));
+}
+
+/**
+*
+* allocateArray
+*
+* function to allocate an uninitialized array of a trivial type from resource, or with new[] if resource is null
+*
+* @param    resource    memory resource, or nullptr
+* @param    count       number of elements
+*
+* @return   the array; the caller initializes the elements
+*/
+template <class T>
+T* allocateArray(std::pmr::memory_resource* resource, int count) {
+	if (resource == nullptr) {
+		return new T[count];
+	}
+
+	return static_cast<T*>(resource->allocate(sizeof(T) * count, alignof(T)));
+}
+
+/**
+*
+* deallocateArray
+*
+* function to free an array made by allocateArray with the same resource and count
+*
+* @param    resource    memory resource the array came from, or nullptr
+* @param    array       array to free
+* @param    count       number of elements it was allocated with
+*
+* @return   nothing
+*/
+template <class T>
+void deallocateArray(std::pmr::memory_resource* resource, T* array, int count) {
+	if (resource == nullptr) {
+		delete[] array;
+		return;
+	}
+
+	resource->deallocate(array, sizeof(T) * count, alignof(T));
+}
+
+// Define an upstream resource that maps memory in 2 MB huge pages
+//
+// Each request is rounded up to a whole number of huge pages and mapped on its own,
+// so this is meant to sit under a pool or monotonic resource that asks for large
+// chunks, not to serve individual nodes. Explicit huge pages (MAP_HUGETLB) are tried
+// first; if none are reserved the mapping falls back to normal pages with a
+// transparent huge page hint. On platforms without mmap it forwards to new/delete.
+class HugePageResource : public std::pmr::memory_resource {
+public:
+	static const std::size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+	/**
+	*
+	* getMappedBytes
+	*
+	* Method to return the bytes currently mapped by this resource
+	*
+	* @param    none
+	*
+	* @return   mapped bytes
+	*/
+	std::size_t getMappedBytes() const;
+
+private:
+	std::size_t mappedBytes = 0;
+
+	void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+	void do_deallocate(void* memory, std::size_t bytes, std::size_t alignment) override;
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+};
+
+// Define the pooled resource built for HUGE_PAGE_RESOURCE
+//
+// Size-class pools carve nodes out of a monotonic arena whose buffers come from the
+// huge page upstream, so small pool chunks share huge pages instead of each mapping
+// their own. Freed nodes go back to the pools; arena memory is unmapped when the
+// resource is destroyed.
+class HugePagePoolResource : public std::pmr::memory_resource {
+public:
+	// Constructor starts the arena at one huge page
+	HugePagePoolResource();
+
+private:
+	std::pmr::monotonic_buffer_resource arena;
+	std::pmr::unsynchronized_pool_resource pools;
+
+	void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+	void do_deallocate(void* memory, std::size_t bytes, std::size_t alignment) override;
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+};
+
+/**
+*
+* hugePageResource
+*
+* function to return the process-wide HugePageResource
+*
+* @param    none
+*
+* @return   the shared huge page resource
+*/
+HugePageResource* hugePageResource();
+
+/**
+*
+* createMemoryResource
+*
+* function to build a resource of the given kind; the caller deletes it after every structure using it
+*
+* @param    kind    DEFAULT_RESOURCE returns nullptr (plain new/delete); MONOTONIC_RESOURCE an arena
+*                   that frees nothing until it is destroyed; POOL_RESOURCE size-class pools over
+*                   new/delete; HUGE_PAGE_RESOURCE the same pools backed by huge pages
+*
+* @return   the new resource, or nullptr for DEFAULT_RESOURCE
+*/
+std::pmr::memory_resource* createMemoryResource(MemoryResourceKind kind);
+
+#endif
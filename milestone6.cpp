@@ -1,260 +1,596 @@
-/**
-*
-* milestone6.cpp : This file contains the 'main' function. Program execution begins and ends there.
-*
-* 09/23/24 - Created by ChatGPT with prompt "write C++ program reads and parses the file: milestone5_config.json"
-*            The file: "milestones5_config.json" is in the following format:
-*
-                {
-                    "Milestone5": [
-                        {
-                            "files": [
-                                {
-                                    "inputFile": "milestone5.json",
-                                    "outputFile": "generatedOutputFile.txt",
-                                    "errorLogFile":"logFile.txt"
-                                }
-                            ],
-                            "defaultVariables": [
-                                {
-                                    "FIFOListSize": 5,
-                                    "hashTableSize": 101
-                                }
-                            ]
-                        }
-                    ]
-                }
-            and where the inputFile has the following format:
-                {
-                    "hashTable": [
-                        {
-                            "testCase1": [
-                                {
-                            "isEmpty": {}
-                        },
-                        {
-                            "add": {"key" : 20, "fullName" : "John Doe2", "address" : "1234 Log St", "city" : "Oakland", "state" : "CA", "zip" : "12345"}
-                        },
-                          ...
-                        ]
-                      }
-                    ]
-                }
-
-1/10/2025 - modified by H. Hui; added separate files, DEFINE and comments
-1/13/2025 - modified by H. Hui; moved DoublyLinkedList print methods to main as functions; added code to remove oldest nodes from hash table and FIFO list, if FIFOSize limit was exceeded
-1/14/2025 - modified by H. Hui; modified print functions, so that it would print name, address, city, state and zip fields from the FIFO list
-5/17/2025 - modified by Adrian Aquino; renamed to milestone6.cpp for milestone 6
-5/21/2025 - modified by Adrian Aquino; updated for corrected red-black tree implementation
-*/
-#define _CRT_SECURE_NO_WARNINGS
-#define CONFIG_FILE "milestone6_config.json"
-
-#include <iostream>
-#include <fstream>
-#include <string>
-
-#include "json.hpp"
-#include "cache_manager.h"
-
-using json = nlohmann::json;
-
-std::ofstream _outFile;
-
-/**
-*
-* getOutFile
-*
-* function to return pointer to outFile
-*
-* @param        none
-*
-* @return       pointer to output file
-*/
-std::ofstream& getOutFile() {
-    return _outFile;
-}
-
-/**
-*
-* setOutFile
-*
-* function to set path and open output file
-*
-* @param filePath       the path to output file
-*
-* @return               nothing
-*/
-void setOutFile(const std::string& filePath) {
-    if (_outFile.is_open()) {
-        _outFile.close();
-    }
-
-    _outFile.open(filePath);
-    if (!_outFile.is_open()) {
-        std::cerr << "Failed to open file: " << filePath << std::endl;
-    }
-}
-
-/**
- * @brief Logs a message to both the console and the output file.
- *
- * This helper function prints a message to the console and writes the same
- * message to the output file.
- *
- * @param message The message to log
- */
-void logToFileAndConsole(std::string message) {
-    std::ofstream& outFile = getOutFile();
-
-    std::cout << message << std::endl;
-    outFile << message << std::endl;
-}
-
-/**
-*
-* processTestCase
-*
-* function to proocess test cases, based upon test data in json format
-*
-* @param    cacheManager    cacheManager to test
-* @param    testCaseName    test name
-* @param    testCaseArray   test array
-*
-* @return                   nothing, but output is sent to console and written to output file
-*/
-void processTestCase(CacheManager* cacheManager, const std::string& testCaseName, const json& testCaseArray) {
-    logToFileAndConsole("\nProcessing " + testCaseName + ":\n\n");
-
-    for (size_t i = 0; i < testCaseArray.size(); ++i) {
-        const json& entry = testCaseArray[i];
-
-        for (json::const_iterator it = entry.begin(); it != entry.end(); ++it) {
-            const std::string& actionName = it.key();
-            const json& details = it.value();
-
-            if (actionName == "isEmpty") {
-                bool result = cacheManager->isEmpty();
-                logToFileAndConsole("isEmpty: " + std::to_string(result));
-            }
-            else if (actionName == "contains") {
-                int key = details["key"];
-                bool result = cacheManager->contains(key);
-                logToFileAndConsole("contains(" + std::to_string(key) + "): " + std::to_string(result));
-            }
-            else if (actionName == "getSize") {
-                int result = cacheManager->getSize();
-                logToFileAndConsole("getSize: " + std::to_string(result));
-            }
-            else if (actionName == "add") {
-                int key = details["key"];
-                DllNode* newDllNode = new DllNode(key, details["fullName"], details["address"], details["city"], details["state"], details["zip"]);
-                cacheManager->add(key, newDllNode);
-                logToFileAndConsole("add key to cacheManager: " + std::to_string(key));
-            }
-            else if (actionName == "remove") {
-                int key = details["key"];
-                cacheManager->remove(key);
-                logToFileAndConsole("remove key: " + std::to_string(key) + " from cacheManager");
-            }
-            else if (actionName == "clear") {
-                cacheManager->clear();
-                logToFileAndConsole("clear cacheManager: ");
-            }
-            else if (actionName == "sort") {
-                bool ascending = true;
-                std::string value = details["ascending"];
-                if (value == "true") {
-                    logToFileAndConsole("sort ascending cacheManager");
-                }
-                else {
-                    ascending = false;
-                    logToFileAndConsole("sort descending cacheManager");
-                }
-
-                cacheManager->sort(ascending);
-            }
-            else if (actionName == "printRange") {
-                int lowValue = details["low"];
-                int highValue = details["high"];
-
-                logToFileAndConsole("printRange with low: " + std::to_string(lowValue) + " and high: " + std::to_string(highValue));
-                cacheManager->printRange(lowValue, highValue);
-            }
-        }
-    }
-}
-
-/**
-*
-* main
-*
-* main function which does the following:
-*   read config file for input file, output file, error file, hash table size and FIFO size
-*   create a hash table
-*   for each of the test case
-*       process test cases - display results to console and write to output file
-*       print out the hash table
-*       clear out hash table
-*
-* @param    none
-*
-* @return   nothing, but output is written to console and files
-*/
-int main() {
-    std::ifstream configFile(CONFIG_FILE);
-    if (!configFile.is_open()) {
-        std::cerr << "Error opening config file!" << std::endl;
-        return 1;
-    }
-
-    json config;
-    configFile >> config;
-
-    std::string inputFilePath = config["Milestone6"][0]["files"][0]["inputFile"];
-    std::string outputFilePath = config["Milestone6"][0]["files"][0]["outputFile"];
-    std::string errorFilePath = config["Milestone6"][0]["files"][0]["errorLogFile"];
-
-    int HASH_SIZE = config["Milestone6"][0]["defaultVariables"][0]["hashTableSize"];
-
-    int FIFO_SIZE = config["Milestone6"][0]["defaultVariables"][0]["FIFOListSize"];
-
-    CacheManager* cacheManager = new CacheManager(FIFO_SIZE, HASH_SIZE);
-
-    std::ifstream inputFile(inputFilePath);
-    if (!inputFile.is_open()) {
-        std::cerr << "Failed to open the file: " << inputFilePath << ".\n";
-        return 1;
-    }
-
-    setOutFile(outputFilePath);
-
-    std::ofstream& outFile = getOutFile();
-
-    json data;
-    inputFile >> data;
-
-    for (size_t i = 0; i < data["cacheManager"].size(); ++i) {
-        const json& testCase = data["cacheManager"][i];
-        for (json::const_iterator it = testCase.begin(); it != testCase.end(); ++it) {
-            const std::string& testCaseName = it.key();
-            const json& testCaseArray = it.value();
-            processTestCase(cacheManager, testCaseName, testCaseArray);
-
-            cacheManager->printCache();
-
-            cacheManager->sort(true);
-
-            cacheManager->sort(false);
-
-            cacheManager->clear();
-        }
-    }
-
-    configFile.close();
-    inputFile.close();
-    outFile.close();
-
-    logToFileAndConsole("\n\nEnd of unit tests");
-    return 0;
+/**
+*
+* milestone6.cpp : This file contains the 'main' function. Program execution begins and ends there.
+*
+* 09/23/24 - Created by ChatGPT with prompt "write C++ program reads and parses the file: milestone5_config.json"
+*            The file: "milestones5_config.json" is in the following format:
+*
+                {
+                    "Milestone5": [
+                        {
+                            "files": [
+                                {
+                                    "inputFile": "milestone5.json",
+                                    "outputFile": "generatedOutputFile.txt",
+                                    "errorLogFile":"logFile.txt"
+                                }
+                            ],
+                            "defaultVariables": [
+                                {
+                                    "FIFOListSize": 5,
+                                    "hashTableSize": 101
+                                }
+                            ]
+                        }
+                    ]
+                }
+            and where the inputFile has the following format:
+                {
+                    "hashTable": [
+                        {
+                            "testCase1": [
+                                {
+                            "isEmpty": {}
+                        },
+                        {
+                            "add": {"key" : 20, "fullName" : "John Doe2", "address" : "1234 Log St", "city" : "Oakland", "state" : "CA", "zip" : "12345"}
+                        },
+                          ...
+                        ]
+                      }
+                    ]
+                }
+
+1/10/2025 - modified by H. Hui; added separate files, DEFINE and comments
+1/13/2025 - modified by H. Hui; moved DoublyLinkedList print methods to main as functions; added code to remove oldest nodes from hash table and FIFO list, if FIFOSize limit was exceeded
+1/14/2025 - modified by H. Hui; modified print functions, so that it would print name, address, city, state and zip fields from the FIFO list
+5/17/2025 - modified by Adrian Aquino; renamed to milestone6.cpp for milestone 6
+5/21/2025 - modified by Adrian Aquino; updated for corrected red-black tree implementation
+10/18/2026 - added optional hashTableEngine config variable ("chained" or "openAddressing")
+10/18/2026 - hashTableEngine also accepts "swissTable"
+10/18/2026 - added optional hashPolicy config variable for the chained engine
+10/18/2026 - add builds a CacheEntry, the single allocation CacheManager keeps per item
+10/18/2026 - add passes the payload so CacheManager can fill a recycled entry; added optional preallocateEntries config variable
+10/18/2026 - added optional memoryResource config variable; the CacheManager and its resource are freed at exit
+10/18/2026 - added containsMany action
+10/18/2026 - added optional evictionPolicy config variable ("lru" or "clock")
+10/18/2026 - evictionPolicy also accepts "tinyLfu"
+10/18/2026 - evictionPolicy also accepts "arc"
+10/18/2026 - evictionPolicy also accepts "s3fifo"
+10/18/2026 - evictionPolicy also accepts "gdsf"; add takes an optional "cost"
+10/18/2026 - added optional maxWeightBytes config variable
+10/18/2026 - add takes an optional "ttl" in milliseconds; added advanceTime action, which moves the test clock
+10/18/2026 - added containsNoTouch and promote actions
+10/18/2026 - added getItemDeferred and drainHits actions
+10/18/2026 - added optional orderedIndex config variable ("redBlackTree" or "bPlusTree")
+10/18/2026 - added rank, select, countInRange and percentile actions
+10/18/2026 - added forEachInRange action
+10/18/2026 - added configure action, which rebuilds the cacheManager for one test case with some config variables
+             overridden, and getArcTarget action
+10/18/2026 - added printCache action, to show list order in the middle of a test case
+10/18/2026 - orderedIndex also accepts "bplus"
+10/18/2026 - added addMany action
+10/18/2026 - configure also takes memoryResource; the shipped config is back to new/delete without preallocation
+10/18/2026 - added getInflation action
+10/18/2026 - added getWeightedSize action
+*/
+#define _CRT_SECURE_NO_WARNINGS
+#define CONFIG_FILE "milestone6_config.json"
+
+#include <chrono>
+#include <iostream>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "json.hpp"
+#include "cache_manager.h"
+
+using json = nlohmann::json;
+
+std::ofstream _outFile;
+
+// The CacheManager's clock: test time in milliseconds, moved only by advanceTime actions so ttl results repeat
+long long _testTime = 0;
+
+/**
+*
+* getTestTime
+*
+* function to return the current test time
+*
+* @param        none
+*
+* @return       milliseconds of test time
+*/
+long long getTestTime() {
+    return _testTime;
+}
+
+/**
+*
+* getOutFile
+*
+* function to return pointer to outFile
+*
+* @param        none
+*
+* @return       pointer to output file
+*/
+std::ofstream& getOutFile() {
+    return _outFile;
+}
+
+/**
+*
+* setOutFile
+*
+* function to set path and open output file
+*
+* @param filePath       the path to output file
+*
+* @return               nothing
+*/
+void setOutFile(const std::string& filePath) {
+    if (_outFile.is_open()) {
+        _outFile.close();
+    }
+
+    _outFile.open(filePath);
+    if (!_outFile.is_open()) {
+        std::cerr << "Failed to open file: " << filePath << std::endl;
+    }
+}
+
+/**
+ * @brief Logs a message to both the console and the output file.
+ *
+ * This helper function prints a message to the console and writes the same
+ * message to the output file.
+ *
+ * @param message The message to log
+ */
+void logToFileAndConsole(std::string message) {
+    std::ofstream& outFile = getOutFile();
+
+    std::cout << message << std::endl;
+    outFile << message << std::endl;
+}
+
+/**
+*
+* parseHashEngine
+*
+* function to map the hashTableEngine config value to a HashEngine
+*
+* @param    value       "chained", "openAddressing" or "swissTable"
+*
+* @return               the matching HashEngine; CHAINED for unknown values
+*/
+HashEngine parseHashEngine(const std::string& value) {
+    if (value == "openAddressing") {
+        return OPEN_ADDRESSING;
+    }
+    if (value == "swissTable") {
+        return SWISS_TABLE;
+    }
+    return CHAINED;
+}
+
+/**
+*
+* parseOrderedIndex
+*
+* function to map the orderedIndex config value to an OrderedIndexEngine
+*
+* @param    value       "redBlackTree" or "bPlusTree" ("bplus" for short)
+*
+* @return               the matching OrderedIndexEngine; RED_BLACK_TREE for unknown values
+*/
+OrderedIndexEngine parseOrderedIndex(const std::string& value) {
+    if (value == "bPlusTree" || value == "bplus") {
+        return B_PLUS_TREE;
+    }
+    return RED_BLACK_TREE;
+}
+
+/**
+*
+* parseHashPolicy
+*
+* function to map the hashPolicy config value to a HashPolicyKind
+*
+* @param    value       "modulo", "fibonacci", "fastRange" or "powerOfTwoMask"
+*
+* @return               the matching HashPolicyKind; MODULO_HASH for unknown values
+*/
+HashPolicyKind parseHashPolicy(const std::string& value) {
+    if (value == "fibonacci") {
+        return FIBONACCI_HASH;
+    }
+    if (value == "fastRange") {
+        return FAST_RANGE_HASH;
+    }
+    if (value == "powerOfTwoMask") {
+        return POWER_OF_TWO_MASK_HASH;
+    }
+    return MODULO_HASH;
+}
+
+/**
+*
+* parseEvictionPolicy
+*
+* function to map the evictionPolicy config value to an EvictionPolicy
+*
+* @param    value       "lru", "clock", "tinyLfu", "arc", "s3fifo" or "gdsf"
+*
+* @return               the matching EvictionPolicy; LRU_EVICTION for unknown values
+*/
+EvictionPolicy parseEvictionPolicy(const std::string& value) {
+    if (value == "clock") {
+        return CLOCK_EVICTION;
+    }
+    if (value == "tinyLfu") {
+        return TINY_LFU_EVICTION;
+    }
+    if (value == "arc") {
+        return ARC_EVICTION;
+    }
+    if (value == "s3fifo") {
+        return S3_FIFO_EVICTION;
+    }
+    if (value == "gdsf") {
+        return GDSF_EVICTION;
+    }
+    return LRU_EVICTION;
+}
+
+/**
+*
+* parseMemoryResource
+*
+* function to map the memoryResource config value to a MemoryResourceKind
+*
+* @param    value       "default", "monotonic", "pool" or "hugePage"
+*
+* @return               the matching MemoryResourceKind; DEFAULT_RESOURCE for unknown values
+*/
+MemoryResourceKind parseMemoryResource(const std::string& value) {
+    if (value == "monotonic") {
+        return MONOTONIC_RESOURCE;
+    }
+    if (value == "pool") {
+        return POOL_RESOURCE;
+    }
+    if (value == "hugePage") {
+        return HUGE_PAGE_RESOURCE;
+    }
+    return DEFAULT_RESOURCE;
+}
+
+/**
+*
+* createCacheManager
+*
+* function to build a cacheManager from config variables in the defaultVariables format
+*
+* @param    variables       hashTableSize, FIFOListSize and the optional engine and policy variables
+* @param    memoryResource  source of the cacheManager's storage; nullptr = new/delete
+*
+* @return                   the new cacheManager
+*/
+CacheManager* createCacheManager(const json& variables, std::pmr::memory_resource* memoryResource) {
+    int HASH_SIZE = variables["hashTableSize"];
+
+    int FIFO_SIZE = variables["FIFOListSize"];
+
+    CacheOptions options;
+    options.hashEngine = parseHashEngine(variables.value("hashTableEngine", "chained"));
+    options.hashPolicy = parseHashPolicy(variables.value("hashPolicy", "modulo"));
+    options.orderedIndex = parseOrderedIndex(variables.value("orderedIndex", "redBlackTree"));
+    options.evictionPolicy = parseEvictionPolicy(variables.value("evictionPolicy", "lru"));
+    options.preallocateEntries = variables.value("preallocateEntries", false);
+    options.maxWeightBytes = variables.value("maxWeightBytes", (size_t)0);
+    options.clock = getTestTime;
+    options.memoryResource = memoryResource;
+
+    return new CacheManager(FIFO_SIZE, HASH_SIZE, options);
+}
+
+/**
+*
+* processTestCase
+*
+* function to proocess test cases, based upon test data in json format
+*
+* @param    cacheManager        cacheManager to test; a configure action replaces it
+* @param    testCaseName        test name
+* @param    testCaseArray       test array
+* @param    defaultVariables    config variables a configure action starts from
+* @param    memoryResource      source of the storage of a cacheManager built by configure
+*                               without its own memoryResource variable
+* @param    caseResource        resource built for this test case by configure, or nullptr;
+*                               the caller deletes it after cacheManager
+*
+* @return                   true if a configure action replaced cacheManager, false otherwise;
+*                           output is sent to console and written to output file
+*/
+bool processTestCase(CacheManager*& cacheManager, const std::string& testCaseName, const json& testCaseArray, const json& defaultVariables, std::pmr::memory_resource* memoryResource, std::pmr::memory_resource*& caseResource) {
+    logToFileAndConsole("\nProcessing " + testCaseName + ":\n\n");
+
+    bool configured = false;
+
+    for (size_t i = 0; i < testCaseArray.size(); ++i) {
+        const json& entry = testCaseArray[i];
+
+        for (json::const_iterator it = entry.begin(); it != entry.end(); ++it) {
+            const std::string& actionName = it.key();
+            const json& details = it.value();
+
+            if (actionName == "configure") {
+                // The test case gets a fresh cacheManager built from the defaults with these variables overridden
+                json variables = defaultVariables;
+                variables.update(details);
+
+                delete cacheManager;
+                delete caseResource;
+                caseResource = nullptr;
+
+                // A memoryResource variable gets a resource of its own, freed after this test case
+                std::pmr::memory_resource* resource = memoryResource;
+                if (details.contains("memoryResource")) {
+                    caseResource = createMemoryResource(parseMemoryResource(details["memoryResource"]));
+                    resource = caseResource;
+                }
+
+                cacheManager = createCacheManager(variables, resource);
+                configured = true;
+                logToFileAndConsole("configure cacheManager: " + details.dump());
+            }
+            else if (actionName == "isEmpty") {
+                bool result = cacheManager->isEmpty();
+                logToFileAndConsole("isEmpty: " + std::to_string(result));
+            }
+            else if (actionName == "contains") {
+                int key = details["key"];
+                bool result = cacheManager->contains(key);
+                logToFileAndConsole("contains(" + std::to_string(key) + "): " + std::to_string(result));
+            }
+            else if (actionName == "containsMany") {
+                std::vector<int> keys = details["keys"].get<std::vector<int>>();
+                std::unique_ptr<bool[]> results(new bool[keys.size()]);
+                cacheManager->containsMany(keys.data(), (int)keys.size(), results.get());
+
+                std::string message = "containsMany(";
+                for (size_t k = 0; k < keys.size(); k++) {
+                    message += ((k > 0) ? ", " : "") + std::to_string(keys[k]);
+                }
+                message += "):";
+                for (size_t k = 0; k < keys.size(); k++) {
+                    message += " " + std::to_string(results[k]);
+                }
+                logToFileAndConsole(message);
+            }
+            else if (actionName == "containsNoTouch") {
+                int key = details["key"];
+                bool result = cacheManager->containsNoTouch(key);
+                logToFileAndConsole("containsNoTouch(" + std::to_string(key) + "): " + std::to_string(result));
+            }
+            else if (actionName == "promote") {
+                std::vector<int> keys = details["keys"].get<std::vector<int>>();
+                int promoted = cacheManager->promote(keys.data(), (int)keys.size());
+                logToFileAndConsole("promote " + std::to_string(keys.size()) + " keys: " + std::to_string(promoted) + " cached");
+            }
+            else if (actionName == "getItemDeferred") {
+                int key = details["key"];
+                bool result = cacheManager->getItemDeferred(key) != nullptr;
+                logToFileAndConsole("getItemDeferred(" + std::to_string(key) + "): " + std::to_string(result));
+            }
+            else if (actionName == "drainHits") {
+                int applied = cacheManager->drainHits();
+                logToFileAndConsole("drainHits: " + std::to_string(applied) + " hits applied");
+            }
+            else if (actionName == "printCache") {
+                cacheManager->printCache();
+            }
+            else if (actionName == "getInflation") {
+                double result = cacheManager->getInflation();
+                logToFileAndConsole("getInflation: " + std::to_string(result));
+            }
+            else if (actionName == "getWeightedSize") {
+                size_t result = cacheManager->getWeightedSize();
+                logToFileAndConsole("getWeightedSize: " + std::to_string(result) + " of " + std::to_string(cacheManager->getMaxWeightBytes()) + " bytes");
+            }
+            else if (actionName == "getArcTarget") {
+                int result = cacheManager->getArcTarget();
+                logToFileAndConsole("getArcTarget: " + std::to_string(result));
+            }
+            else if (actionName == "getSize") {
+                int result = cacheManager->getSize();
+                logToFileAndConsole("getSize: " + std::to_string(result));
+            }
+            else if (actionName == "add") {
+                int key = details["key"];
+                std::chrono::milliseconds ttl(details.value("ttl", 0LL));
+                cacheManager->add(key, details["fullName"], details["address"], details["city"], details["state"], details["zip"], ttl, details.value("cost", 1.0));
+                logToFileAndConsole("add key to cacheManager: " + std::to_string(key));
+            }
+            else if (actionName == "addMany") {
+                // The cacheManager takes ownership of the entries
+                const json& entryArray = details["entries"];
+                std::vector<int> keys;
+                std::vector<CacheEntry*> entries;
+                std::string keyList;
+                for (const json& entryDetails : entryArray) {
+                    int key = entryDetails["key"];
+                    keys.push_back(key);
+                    entries.push_back(new CacheEntry(key, entryDetails["fullName"], entryDetails["address"], entryDetails["city"], entryDetails["state"], entryDetails["zip"]));
+                    keyList += (keyList.empty() ? "" : ", ") + std::to_string(key);
+                }
+                int added = cacheManager->addMany(keys.data(), entries.data(), (int)keys.size());
+                logToFileAndConsole("addMany(" + keyList + "): " + std::to_string(added) + " added");
+            }
+            else if (actionName == "advanceTime") {
+                long long milliseconds = details["milliseconds"];
+                _testTime += milliseconds;
+                logToFileAndConsole("advance time by " + std::to_string(milliseconds) + " ms");
+            }
+            else if (actionName == "remove") {
+                int key = details["key"];
+                cacheManager->remove(key);
+                logToFileAndConsole("remove key: " + std::to_string(key) + " from cacheManager");
+            }
+            else if (actionName == "clear") {
+                cacheManager->clear();
+                logToFileAndConsole("clear cacheManager: ");
+            }
+            else if (actionName == "sort") {
+                bool ascending = true;
+                std::string value = details["ascending"];
+                if (value == "true") {
+                    logToFileAndConsole("sort ascending cacheManager");
+                }
+                else {
+                    ascending = false;
+                    logToFileAndConsole("sort descending cacheManager");
+                }
+
+                cacheManager->sort(ascending);
+            }
+            else if (actionName == "printRange") {
+                int lowValue = details["low"];
+                int highValue = details["high"];
+
+                logToFileAndConsole("printRange with low: " + std::to_string(lowValue) + " and high: " + std::to_string(highValue));
+                cacheManager->printRange(lowValue, highValue);
+            }
+            else if (actionName == "forEachInRange") {
+                int lowValue = details["low"];
+                int highValue = details["high"];
+                bool ascending = details.value("ascending", "true") == "true";
+
+                std::string message = "forEachInRange(" + std::to_string(lowValue) + ", " + std::to_string(highValue) + (ascending ? ", ascending):" : ", descending):");
+                int visited = cacheManager->forEachInRange(lowValue, highValue, [&message](int key, DllNode*) {
+                    message += " " + std::to_string(key);
+                }, ascending);
+                logToFileAndConsole(message + " (" + std::to_string(visited) + " keys)");
+            }
+            else if (actionName == "rank") {
+                int key = details["key"];
+                int result = cacheManager->rank(key);
+                logToFileAndConsole("rank(" + std::to_string(key) + "): " + std::to_string(result));
+            }
+            else if (actionName == "select") {
+                int index = details["index"];
+                DllNode* result = cacheManager->select(index);
+                logToFileAndConsole("select(" + std::to_string(index) + "): " + ((result != nullptr) ? std::to_string(result->key) : "none"));
+            }
+            else if (actionName == "countInRange") {
+                int lowValue = details["low"];
+                int highValue = details["high"];
+                int result = cacheManager->countInRange(lowValue, highValue);
+                logToFileAndConsole("countInRange(" + std::to_string(lowValue) + ", " + std::to_string(highValue) + "): " + std::to_string(result));
+            }
+            else if (actionName == "percentile") {
+                double percent = details["percentile"];
+                DllNode* result = cacheManager->percentile(percent);
+                logToFileAndConsole("percentile(" + details["percentile"].dump() + "): " + ((result != nullptr) ? std::to_string(result->key) : "none"));
+            }
+        }
+    }
+
+    return configured;
+}
+
+/**
+*
+* main
+*
+* main function which does the following:
+*   read config file for input file, output file, error file, hash table size and FIFO size
+*   create a hash table
+*   for each of the test case
+*       process test cases - display results to console and write to output file
+*       (a test case that configures its own cacheManager gets the default one back afterwards)
+*       print out the hash table
+*       clear out hash table
+*
+* @param    none
+*
+* @return   nothing, but output is written to console and files
+*/
+int main() {
+    std::ifstream configFile(CONFIG_FILE);
+    if (!configFile.is_open()) {
+        std::cerr << "Error opening config file!" << std::endl;
+        return 1;
+    }
+
+    json config;
+    configFile >> config;
+
+    std::string inputFilePath = config["Milestone6"][0]["files"][0]["inputFile"];
+    std::string outputFilePath = config["Milestone6"][0]["files"][0]["outputFile"];
+    std::string errorFilePath = config["Milestone6"][0]["files"][0]["errorLogFile"];
+
+    const json& defaultVariables = config["Milestone6"][0]["defaultVariables"][0];
+
+    // Owned here rather than by the CacheManager, so it is deleted after it
+    std::pmr::memory_resource* memoryResource = createMemoryResource(parseMemoryResource(defaultVariables.value("memoryResource", "default")));
+
+    CacheManager* cacheManager = createCacheManager(defaultVariables, memoryResource);
+
+    // A test case that configures its own memoryResource owns it until the test case ends
+    std::pmr::memory_resource* caseResource = nullptr;
+
+    std::ifstream inputFile(inputFilePath);
+    if (!inputFile.is_open()) {
+        std::cerr << "Failed to open the file: " << inputFilePath << ".\n";
+        return 1;
+    }
+
+    setOutFile(outputFilePath);
+
+    std::ofstream& outFile = getOutFile();
+
+    json data;
+    inputFile >> data;
+
+    for (size_t i = 0; i < data["cacheManager"].size(); ++i) {
+        const json& testCase = data["cacheManager"][i];
+        for (json::const_iterator it = testCase.begin(); it != testCase.end(); ++it) {
+            const std::string& testCaseName = it.key();
+            const json& testCaseArray = it.value();
+            bool configured = processTestCase(cacheManager, testCaseName, testCaseArray, defaultVariables, memoryResource, caseResource);
+
+            cacheManager->printCache();
+
+            cacheManager->sort(true);
+
+            cacheManager->sort(false);
+
+            cacheManager->clear();
+
+            // The next test case runs on the configured defaults again
+            if (configured) {
+                delete cacheManager;
+                delete caseResource;
+                caseResource = nullptr;
+                cacheManager = createCacheManager(defaultVariables, memoryResource);
+            }
+        }
+    }
+
+    configFile.close();
+    inputFile.close();
+    outFile.close();
+
+    logToFileAndConsole("\n\nEnd of unit tests");
+
+    delete cacheManager;
+    delete memoryResource;
+
+    return 0;
 }
\ No newline at end of file
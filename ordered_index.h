@@ -0,0 +1,373 @@
+/**
+*
+* ordered_index.h : This is the interface shared by the ordered index engines used by CacheManager.
+*
+* 10/18/26 - Created; SelfBalancingTree (red-black) and BPlusTree both implement it
+* 10/18/26 - Added the order statistics rank, select and countInRange, and percentile built on select
+* 10/18/26 - Added RangeCursor, openRange and forEachInRange, which read a range without printing or allocating
+* 10/18/26 - Added attachSorted, which builds an empty index from a sorted batch in linear time
+*/
+
+#ifndef _ORDERED_INDEX
+#define _ORDERED_INDEX
+
+#include <cmath>
+
+#include "cache_entry.h"
+
+// Ordered index engines that CacheManager can be configured with
+enum OrderedIndexEngine { RED_BLACK_TREE = 0, B_PLUS_TREE = 1 };
+
+class OrderedIndex;
+
+// Define a cursor over the keys of an ordered index in [low, high], ascending or descending
+//
+// A cursor is a plain value: opening and advancing it allocates nothing, and the keys are
+// found one step at a time as next is called. While isValid, key and fifoNode describe the
+// current key. node and position are the engine's own place in its structure (a TreeNode,
+// or a B+tree leaf and a slot in it). Any attach or detach on the index invalidates its
+// open cursors.
+struct RangeCursor {
+	const OrderedIndex* index;
+	const void* node;		// engine's current node; nullptr once the range is exhausted
+	int position;			// engine's slot within node
+	int low;				// the lower bound (inclusive)
+	int high;				// the higher bound (inclusive)
+	bool ascending;			// true to go from low to high, false from high to low
+
+	int key;				// the current key, while isValid
+	DllNode* fifoNode;		// the current key's FIFO node, while isValid
+
+	/**
+	*
+	* isValid
+	*
+	* Method to check if the cursor is on a key
+	*
+	* @param    none
+	*
+	* @return   true if key and fifoNode hold a key in the range, false once it is exhausted
+	*/
+	bool isValid() const {
+		return node != nullptr;
+	}
+
+	/**
+	*
+	* next
+	*
+	* Method to move to the next key in the range, in the cursor's direction
+	*
+	* @param    none
+	*
+	* @return   nothing; the cursor is invalid if no key is left
+	*/
+	void next();
+};
+
+// Define the interface for a sorted key -> FIFO node index
+//
+// CacheManager keeps every cached entry in the ordered index as well as in the hash
+// index, for sorted output and range queries. Entries are owned by CacheManager: an
+// engine links an entry in (attach) and unlinks it (detach), but never deletes it.
+// The const methods only read the index. Both engines keep subtree sizes, so the order
+// statistics (rank, select, countInRange, percentile) cost one descent, not a scan.
+class OrderedIndex {
+public:
+	virtual ~OrderedIndex() {}
+
+	/**
+	*
+	* getNumberOfItems
+	*
+	* Method to return the number of keys in the index
+	*
+	* @param    none
+	*
+	* @return   number of keys
+	*/
+	virtual int getNumberOfItems() const = 0;
+
+	/**
+	*
+	* isEmpty
+	*
+	* Method to check if the index holds no keys
+	*
+	* @param    none
+	*
+	* @return   true if empty, false otherwise
+	*/
+	virtual bool isEmpty() const = 0;
+
+	/**
+	*
+	* attach
+	*
+	* Method to link an entry under its key unless the key is already present
+	*
+	* @param    entry   entry to link, keyed by entry->key
+	*
+	* @return   true if the entry was linked, false if its key was already present
+	*/
+	virtual bool attach(CacheEntry* entry) = 0;
+
+	/**
+	*
+	* attachSorted
+	*
+	* Method to link a batch of entries into an empty index in one linear pass, building the
+	* finished shape directly instead of inserting and rebalancing key by key
+	*
+	* @param    entries     entries to link, in strictly ascending key order
+	* @param    count       number of entries
+	*
+	* @return   true if the batch was linked; false, with nothing linked, if the index is not
+	*           empty or the keys are not strictly ascending
+	*/
+	virtual bool attachSorted(CacheEntry* const* entries, int count) = 0;
+
+	/**
+	*
+	* detach
+	*
+	* Method to unlink an entry without deleting it
+	*
+	* @param    entry   an entry currently linked in this index
+	*
+	* @return   nothing
+	*/
+	virtual void detach(CacheEntry* entry) = 0;
+
+	/**
+	*
+	* detachAll
+	*
+	* Method to unlink every entry without deleting any
+	*
+	* @param    none
+	*
+	* @return   nothing
+	*/
+	virtual void detachAll() = 0;
+
+	/**
+	*
+	* find
+	*
+	* Method to look up a key
+	*
+	* @param    key     key to look up
+	*
+	* @return   the key's FIFO node, or nullptr if the key is not in the index
+	*/
+	virtual DllNode* find(int key) const = 0;
+
+	/**
+	*
+	* collectRange
+	*
+	* Method to copy the FIFO nodes of the keys in [low, high] in ascending key order
+	*
+	* @param    low         the lower bound (inclusive)
+	* @param    high        the higher bound (inclusive)
+	* @param    results     array of at least maxResults pointers to fill
+	* @param    maxResults  most nodes to copy; the scan stops there
+	*
+	* @return   number of nodes copied
+	*/
+	virtual int collectRange(int low, int high, DllNode** results, int maxResults) const = 0;
+
+	/**
+	*
+	* rank
+	*
+	* Method to count the keys smaller than key; key itself need not be in the index
+	*
+	* @param    key     key to rank
+	*
+	* @return   number of keys < key, which is key's 0-based position if it is present
+	*/
+	virtual int rank(int key) const = 0;
+
+	/**
+	*
+	* select
+	*
+	* Method to find the key at a 0-based position in ascending order
+	*
+	* @param    index   position, 0 for the smallest key
+	*
+	* @return   that key's FIFO node, or nullptr if index is not in [0, getNumberOfItems())
+	*/
+	virtual DllNode* select(int index) const = 0;
+
+	/**
+	*
+	* countInRange
+	*
+	* Method to count the keys in [low, high]
+	*
+	* @param    low     the lower bound (inclusive)
+	* @param    high    the higher bound (inclusive)
+	*
+	* @return   number of keys in the range; 0 if low > high
+	*/
+	virtual int countInRange(int low, int high) const = 0;
+
+	/**
+	*
+	* seekRange
+	*
+	* Method to put a cursor whose index, bounds and direction are set on the first key of
+	* its range in its direction (the smallest key >= low, or the largest key <= high)
+	*
+	* @param    cursor  cursor to position
+	*
+	* @return   nothing; the cursor is invalid if the range holds no key
+	*/
+	virtual void seekRange(RangeCursor& cursor) const = 0;
+
+	/**
+	*
+	* stepRange
+	*
+	* Method to move a valid cursor to the next key of its range in its direction
+	*
+	* @param    cursor  cursor to move
+	*
+	* @return   nothing; the cursor is invalid if no key is left
+	*/
+	virtual void stepRange(RangeCursor& cursor) const = 0;
+
+	/**
+	*
+	* openRange
+	*
+	* Method to open a cursor on the keys in [low, high]
+	*
+	* @param    low         the lower bound (inclusive)
+	* @param    high        the higher bound (inclusive)
+	* @param    ascending   true to visit the keys from low to high, false from high to low
+	*
+	* @return   a cursor on the first key in that direction; invalid if the range is empty
+	*/
+	RangeCursor openRange(int low, int high, bool ascending = true) const {
+		RangeCursor cursor;
+		cursor.index = this;
+		cursor.node = nullptr;
+		cursor.position = 0;
+		cursor.low = low;
+		cursor.high = high;
+		cursor.ascending = ascending;
+		cursor.key = 0;
+		cursor.fifoNode = nullptr;
+
+		if (low <= high) {
+			seekRange(cursor);
+		}
+		return cursor;
+	}
+
+	/**
+	*
+	* forEachInRange
+	*
+	* Method to call callback(key, fifoNode) for every key in [low, high]; the callback must not
+	* attach to or detach from the index
+	*
+	* @param    low         the lower bound (inclusive)
+	* @param    high        the higher bound (inclusive)
+	* @param    callback    function or lambda taking (int key, DllNode* fifoNode)
+	* @param    ascending   true to visit the keys from low to high, false from high to low
+	*
+	* @return   number of keys visited
+	*/
+	template <class Callback>
+	int forEachInRange(int low, int high, Callback callback, bool ascending = true) const {
+		int visited = 0;
+
+		for (RangeCursor cursor = openRange(low, high, ascending); cursor.isValid(); cursor.next()) {
+			callback(cursor.key, cursor.fifoNode);
+			visited++;
+		}
+		return visited;
+	}
+
+	/**
+	*
+	* percentile
+	*
+	* Method to find the key at a percentile by the nearest-rank method: the smallest key
+	* with at least percent% of the keys at or below it
+	*
+	* @param    percent     percentile, clamped to [0, 100]; 0 gives the smallest key, 100 the largest
+	*
+	* @return   that key's FIFO node, or nullptr if the index is empty
+	*/
+	DllNode* percentile(double percent) const {
+		int count = getNumberOfItems();
+		if (count == 0) {
+			return nullptr;
+		}
+
+		percent = (percent < 0.0) ? 0.0 : (percent > 100.0) ? 100.0 : percent;
+		int position = (int)std::ceil(percent / 100.0 * count) - 1;
+		return select((position < 0) ? 0 : position);
+	}
+
+	/**
+	*
+	* printRange
+	*
+	* Method to print every key in [low, high] with its payload, in ascending order
+	*
+	* @param    low     the lower bound (inclusive)
+	* @param    high    the higher bound (inclusive)
+	*
+	* @return   nothing, but prints out the keys between low and high
+	*/
+	virtual void printRange(int low, int high) = 0;
+
+	/**
+	*
+	* printInOrder
+	*
+	* Method to print every key in ascending order
+	*
+	* @param    none
+	*
+	* @return   nothing, but prints out the keys
+	*/
+	virtual void printInOrder() const = 0;
+
+	/**
+	*
+	* printReverseOrder
+	*
+	* Method to print every key in descending order
+	*
+	* @param    none
+	*
+	* @return   nothing, but prints out the keys
+	*/
+	virtual void printReverseOrder() const = 0;
+
+	/**
+	*
+	* printBreadthFirst
+	*
+	* Method to print the index's nodes level by level, showing its shape
+	*
+	* @param    none
+	*
+	* @return   nothing, but prints out the nodes
+	*/
+	virtual void printBreadthFirst() const = 0;
+};
+
+inline void RangeCursor::next() {
+	index->stepRange(*this);
+}
+
+#endif
@@ -7,6 +7,19 @@
 * 04/21/25 - Added for Milestone 5: printReverseOrder, printRange methods
 * 05/17/25 - Modified by Adrian Aquino; renamed binary_search_tree.cpp to self_balancing_tree.cpp and added red-black tree functionality
 * 05/21/25 - Modified by Adrian Aquino; updated red-black tree implementation with proper color handling and parent pointers
+* 10/18/26 - Replaced recursive insertRB + findNode with findOrInsert, a single iterative descent;
+*            fixInsertion relinks rotated subtrees through the pre-rotation parent (nodes were being lost);
+*            removeNode is one iterative descent with a post-unlink fixDeletion, replacing removeRB
+* 10/18/26 - Added findOrAttach/detach/detachAll; removal splices the node out (swapping it with its
+*            successor) instead of copying the successor's key, so nodes can live inside a CacheEntry
+* 10/18/26 - Nodes are allocated and freed through the tree's memory resource
+* 10/18/26 - Added peek; contains is built on it
+* 10/18/26 - Implements OrderedIndex: added getNumberOfItems, attach, detach(CacheEntry*), find, collectRange and successor
+* 10/18/26 - Added rank, select and countInRange (with countBelow) on the numberOfNodes subtree counts
+* 10/18/26 - fixInsertion and findNode are loops; insert, delete and lookup no longer recurse
+* 10/18/26 - Added seekRange, stepRange and predecessor for RangeCursor
+* 10/18/26 - Added attachSorted and addSorted (buildFromSorted, buildBalanced): a linear-time balanced build
+* 10/18/26 - attachSorted and addSorted build from the entries or keys directly, without a temporary node array
 */
 
 #include <queue>
@@ -19,8 +32,10 @@ extern void logToFileAndConsole(std::string message);
  * @brief Default constructor for SelfBalancingTree.
  *
  * Initializes an empty self-balancing tree.
+ *
+ * @param resource Memory resource for the nodes findOrInsert allocates (nullptr = new/delete).
  */
-SelfBalancingTree::SelfBalancingTree() : root(nullptr) {}
+SelfBalancingTree::SelfBalancingTree(std::pmr::memory_resource* resource) : root(nullptr), memoryResource(resource) {}
 
 /**
  * @brief Destructor for SelfBalancingTree.
@@ -127,39 +142,52 @@ TreeNode* SelfBalancingTree::rotateRight(TreeNode* y) {
     return x;
 }
 
+/**
+ * @brief Points the link that held oldChild at newChild
+ *
+ * Call with oldChild's parent as it was before a rotation: afterwards oldChild->parent
+ * is the new subtree root, not the node whose link has to change.
+ *
+ * @param parent Parent of oldChild before the rotation, or nullptr if oldChild was the root
+ * @param oldChild Previous root of the subtree
+ * @param newChild New root of the subtree
+ */
+void SelfBalancingTree::replaceChild(TreeNode* parent, TreeNode* oldChild, TreeNode* newChild) {
+    if (parent == nullptr) {
+        root = newChild;
+    } else if (parent->left == oldChild) {
+        parent->left = newChild;
+    } else {
+        parent->right = newChild;
+    }
+}
+
 /**
  * @brief Fixes Red-Black properties after insertion
  *
+ * Walks up from the new node: a red uncle is recolored and the check moves two levels up,
+ * and a black uncle ends the loop with one or two rotations.
+ *
  * @param node Node that was inserted
  */
 void SelfBalancingTree::fixInsertion(TreeNode* node) {
-    if (node == nullptr || node == root) {
-        if (root != nullptr) {
-            root->color = BLACK;
-            root->parent = nullptr;
+    while (node != root && isRed(node->parent)) {
+        TreeNode* parent = node->parent;
+        TreeNode* grandparent = parent->parent;
+        if (grandparent == nullptr) {
+            break;
         }
-        return;
-    }
 
-    TreeNode* parent = node->parent;
-    if (parent == nullptr || !isRed(parent)) {
-        return;
-    }
-
-    TreeNode* grandparent = parent->parent;
-    if (grandparent == nullptr) {
-        parent->color = BLACK;
-        return;
-    }
+        TreeNode* uncle = (parent == grandparent->left) ? grandparent->right : grandparent->left;
 
-    TreeNode* uncle = (parent == grandparent->left) ? grandparent->right : grandparent->left;
+        if (isRed(uncle)) {
+            parent->color = BLACK;
+            uncle->color = BLACK;
+            grandparent->color = RED;
+            node = grandparent;
+            continue;
+        }
 
-    if (isRed(uncle)) {
-        parent->color = BLACK;
-        uncle->color = BLACK;
-        grandparent->color = RED;
-        fixInsertion(grandparent);
-    } else {
         if (parent == grandparent->left) {
             if (node == parent->right) {
                 parent = rotateLeft(parent);
@@ -168,17 +196,8 @@ void SelfBalancingTree::fixInsertion(TreeNode* node) {
             }
             parent->color = BLACK;
             grandparent->color = RED;
-            TreeNode* newSubRoot = rotateRight(grandparent);
-
-            if (grandparent->parent != nullptr) {
-                if (grandparent->parent->left == grandparent) {
-                    grandparent->parent->left = newSubRoot;
-                } else {
-                    grandparent->parent->right = newSubRoot;
-                }
-            } else {
-                root = newSubRoot;
-            }
+            TreeNode* greatGrandparent = grandparent->parent;
+            replaceChild(greatGrandparent, grandparent, rotateRight(grandparent));
         } else {
             if (node == parent->left) {
                 parent = rotateRight(parent);
@@ -187,56 +206,109 @@ void SelfBalancingTree::fixInsertion(TreeNode* node) {
             }
             parent->color = BLACK;
             grandparent->color = RED;
-            TreeNode* newSubRoot = rotateLeft(grandparent);
-
-            if (grandparent->parent != nullptr) {
-                if (grandparent->parent->left == grandparent) {
-                    grandparent->parent->left = newSubRoot;
-                } else {
-                    grandparent->parent->right = newSubRoot;
-                }
-            } else {
-                root = newSubRoot;
-            }
+            TreeNode* greatGrandparent = grandparent->parent;
+            replaceChild(greatGrandparent, grandparent, rotateLeft(grandparent));
         }
+        break;
+    }
+
+    // A red root, or a red parent that is the root, is fixed by making the root black
+    if (root != nullptr) {
+        root->color = BLACK;
+        root->parent = nullptr;
     }
 }
 
 /**
- * @brief Inserts node and returns new subtree root
+ * @brief Finds the node with key, inserting and rebalancing if it is absent, in one descent.
  *
- * @param root Current subtree root
- * @param key Key to insert
- * @param dllNode FIFO node to link
- * @return TreeNode* New subtree root
+ * @param key The key to look up or insert.
+ * @param dllNode FIFO node to link if a new node is created; an existing node is left unchanged.
+ * @param inserted Set to true if a node was created, false if key was already present.
+ * @return TreeNode* The node holding key.
  */
-TreeNode* SelfBalancingTree::insertRB(TreeNode* node, int key, DllNode* dllNode) {
-    if (node == nullptr) {
-        TreeNode* newNode = new TreeNode(key, 1, 0, RED, nullptr, nullptr, nullptr, dllNode);
-        return newNode;
-    }
+TreeNode* SelfBalancingTree::findOrInsert(int key, DllNode* dllNode, bool& inserted) {
+    TreeNode* parent = nullptr;
+    TreeNode* current = root;
 
-    if (key == node->key) {
-        node->fifoNode = dllNode;
-        return node;
+    while (current != nullptr) {
+        if (key == current->key) {
+            inserted = false;
+            return current;
+        }
+
+        parent = current;
+        current = (key < current->key) ? current->left : current->right;
     }
 
-    if (key < node->key) {
-        node->left = insertRB(node->left, key, dllNode);
-        if (node->left != nullptr) {
-            node->left->parent = node;
-        }
-    } else {
-        node->right = insertRB(node->right, key, dllNode);
-        if (node->right != nullptr) {
-            node->right->parent = node;
+    TreeNode* newNode = newObject<TreeNode>(memoryResource, key, 1, 0, RED, nullptr, nullptr, parent, dllNode);
+    linkNewNode(parent, newNode);
+
+    inserted = true;
+    return newNode;
+}
+
+/**
+ * @brief Links a caller-owned node into the tree unless its key is already present.
+ *
+ * The node's links, color and count are reset; the tree never deletes it.
+ *
+ * @param node The node to link, keyed by node->key (e.g. a CacheEntry's treeLinks).
+ * @param inserted Set to true if node was linked, false if its key was already present.
+ * @return TreeNode* The node holding the key (node itself when inserted).
+ */
+TreeNode* SelfBalancingTree::findOrAttach(TreeNode* node, bool& inserted) {
+    TreeNode* parent = nullptr;
+    TreeNode* current = root;
+
+    while (current != nullptr) {
+        if (node->key == current->key) {
+            inserted = false;
+            return current;
         }
+
+        parent = current;
+        current = (node->key < current->key) ? current->left : current->right;
     }
 
-    updateNodeCounts(node);
+    node->numberOfNodes = 1;
+    node->height = 0;
+    node->color = RED;
+    node->left = nullptr;
+    node->right = nullptr;
+    node->parent = parent;
+    linkNewNode(parent, node);
+
+    inserted = true;
     return node;
 }
 
+/**
+ * @brief Links a new red node under parent, updates the subtree counts and rebalances.
+ *
+ * @param parent The node the descent stopped at (nullptr for an empty tree).
+ * @param newNode The node to link; its key is not present in the tree.
+ */
+void SelfBalancingTree::linkNewNode(TreeNode* parent, TreeNode* newNode) {
+    if (parent == nullptr) {
+        root = newNode;
+    } else if (newNode->key < parent->key) {
+        parent->left = newNode;
+    } else {
+        parent->right = newNode;
+    }
+
+    // Every ancestor's subtree gained one node; fixInsertion's rotations recount from the children
+    for (TreeNode* ancestor = parent; ancestor != nullptr; ancestor = ancestor->parent) {
+        ancestor->numberOfNodes++;
+    }
+
+    fixInsertion(newNode);
+
+    root->color = BLACK;
+    root->parent = nullptr;
+}
+
 /**
  * @brief Adds a node with the specified key to the tree.
  *
@@ -244,16 +316,11 @@ TreeNode* SelfBalancingTree::insertRB(TreeNode* node, int key, DllNode* dllNode)
  * @param dllNode Pointer to the DllNode to be linked with this tree node.
  */
 void SelfBalancingTree::addToTree(int key, DllNode* dllNode) {
-    root = insertRB(root, key, dllNode);
+    bool inserted;
+    TreeNode* node = findOrInsert(key, dllNode, inserted);
 
-    TreeNode* newNode = findNode(root, key);
-    if (newNode != nullptr) {
-        fixInsertion(newNode);
-    }
-
-    if (root != nullptr) {
-        root->color = BLACK;
-        root->parent = nullptr;
+    if (!inserted) {
+        node->fifoNode = dllNode;
     }
 }
 
@@ -265,14 +332,11 @@ void SelfBalancingTree::addToTree(int key, DllNode* dllNode) {
  * @return TreeNode* Node with key, or nullptr
  */
 TreeNode* SelfBalancingTree::findNode(TreeNode* node, int key) const {
-    if (node == nullptr) return nullptr;
-
-    if (key == node->key) return node;
+    while (node != nullptr && key != node->key) {
+        node = (key < node->key) ? node->left : node->right;
+    }
 
-    if (key < node->key)
-        return findNode(node->left, key);
-    else
-        return findNode(node->right, key);
+    return node;
 }
 
 /**
@@ -291,179 +355,258 @@ TreeNode* SelfBalancingTree::findMin(TreeNode* node) const {
 }
 
 /**
- * @brief Fixes Red-Black properties after deletion
+ * @brief Finds the node with the next larger key
  *
- * @param node Node being fixed
+ * @param node A node in the tree
+ * @return TreeNode* The in-order successor, or nullptr if node holds the largest key
  */
-void SelfBalancingTree::fixDeletion(TreeNode* node) {
-    if (node == nullptr || node == root) return;
+TreeNode* SelfBalancingTree::successor(TreeNode* node) const {
+    if (node->right != nullptr) {
+        return findMin(node->right);
+    }
 
+    // Climb until coming up from a left child; that parent is the next key
     TreeNode* parent = node->parent;
-    if (parent == nullptr) return;
+    while (parent != nullptr && node == parent->right) {
+        node = parent;
+        parent = parent->parent;
+    }
 
-    TreeNode* sibling = (node == parent->left) ? parent->right : parent->left;
+    return parent;
+}
 
-    if (isRed(sibling)) {
-        setColor(parent, RED);
-        setColor(sibling, BLACK);
+/**
+ * @brief Fixes Red-Black properties after a black node was unlinked
+ *
+ * @param node Node that took the unlinked node's place (may be nullptr); it carries an extra black
+ * @param parent Parent of node
+ */
+void SelfBalancingTree::fixDeletion(TreeNode* node, TreeNode* parent) {
+    while (node != root && !isRed(node)) {
         if (node == parent->left) {
-            TreeNode* newSubRoot = rotateLeft(parent);
-            if (parent->parent != nullptr) {
-                if (parent->parent->left == parent) {
-                    parent->parent->left = newSubRoot;
-                } else {
-                    parent->parent->right = newSubRoot;
-                }
-            } else {
-                root = newSubRoot;
+            TreeNode* sibling = parent->right;
+
+            if (isRed(sibling)) {
+                setColor(sibling, BLACK);
+                setColor(parent, RED);
+                TreeNode* grandparent = parent->parent;
+                replaceChild(grandparent, parent, rotateLeft(parent));
+                sibling = parent->right;
             }
-        } else {
-            TreeNode* newSubRoot = rotateRight(parent);
-            if (parent->parent != nullptr) {
-                if (parent->parent->left == parent) {
-                    parent->parent->left = newSubRoot;
-                } else {
-                    parent->parent->right = newSubRoot;
-                }
-            } else {
-                root = newSubRoot;
+
+            if (!isRed(sibling->left) && !isRed(sibling->right)) {
+                setColor(sibling, RED);
+                node = parent;
+                parent = node->parent;
+                continue;
             }
-        }
-        sibling = (node == parent->left) ? parent->right : parent->left;
-    }
 
-    if (!isRed(sibling) && !isRed(sibling->left) && !isRed(sibling->right)) {
-        setColor(sibling, RED);
-        if (getColor(parent) == BLACK) {
-            fixDeletion(parent);
-        } else {
+            if (!isRed(sibling->right)) {
+                setColor(sibling->left, BLACK);
+                setColor(sibling, RED);
+                replaceChild(parent, sibling, rotateRight(sibling));
+                sibling = parent->right;
+            }
+
+            setColor(sibling, getColor(parent));
             setColor(parent, BLACK);
-        }
-        return;
-    }
+            setColor(sibling->right, BLACK);
+            TreeNode* grandparent = parent->parent;
+            replaceChild(grandparent, parent, rotateLeft(parent));
+            node = root;
+        } else {
+            TreeNode* sibling = parent->left;
+
+            if (isRed(sibling)) {
+                setColor(sibling, BLACK);
+                setColor(parent, RED);
+                TreeNode* grandparent = parent->parent;
+                replaceChild(grandparent, parent, rotateRight(parent));
+                sibling = parent->left;
+            }
 
-    if ((node == parent->left && isRed(sibling->left) && !isRed(sibling->right)) ||
-        (node == parent->right && isRed(sibling->right) && !isRed(sibling->left))) {
+            if (!isRed(sibling->left) && !isRed(sibling->right)) {
+                setColor(sibling, RED);
+                node = parent;
+                parent = node->parent;
+                continue;
+            }
 
-        if (node == parent->left) {
+            if (!isRed(sibling->left)) {
+                setColor(sibling->right, BLACK);
+                setColor(sibling, RED);
+                replaceChild(parent, sibling, rotateLeft(sibling));
+                sibling = parent->left;
+            }
+
+            setColor(sibling, getColor(parent));
+            setColor(parent, BLACK);
             setColor(sibling->left, BLACK);
-            setColor(sibling, RED);
-            parent->right = rotateRight(sibling);
-            if (parent->right != nullptr) parent->right->parent = parent;
-            sibling = parent->right;
-        } else {
-            setColor(sibling->right, BLACK);
-            setColor(sibling, RED);
-            parent->left = rotateLeft(sibling);
-            if (parent->left != nullptr) parent->left->parent = parent;
-            sibling = parent->left;
+            TreeNode* grandparent = parent->parent;
+            replaceChild(grandparent, parent, rotateRight(parent));
+            node = root;
         }
     }
 
-    setColor(sibling, getColor(parent));
-    setColor(parent, BLACK);
+    setColor(node, BLACK);
+}
 
-    if (node == parent->left) {
-        setColor(sibling->right, BLACK);
-        TreeNode* newSubRoot = rotateLeft(parent);
-        if (parent->parent != nullptr) {
-            if (parent->parent->left == parent) {
-                parent->parent->left = newSubRoot;
-            } else {
-                parent->parent->right = newSubRoot;
-            }
-        } else {
-            root = newSubRoot;
-        }
-    } else {
-        setColor(sibling->left, BLACK);
-        TreeNode* newSubRoot = rotateRight(parent);
-        if (parent->parent != nullptr) {
-            if (parent->parent->left == parent) {
-                parent->parent->left = newSubRoot;
-            } else {
-                parent->parent->right = newSubRoot;
-            }
-        } else {
-            root = newSubRoot;
-        }
+/**
+ * @brief Removes a node with the specified key from the tree.
+ *
+ * One descent finds the node, which is then spliced out by detach and deleted.
+ *
+ * @param key The key of the node to remove.
+ * @return True if the node was removed, false if the key wasn't found.
+ */
+bool SelfBalancingTree::removeNode(int key) {
+    TreeNode* node = root;
+    while (node != nullptr && key != node->key) {
+        node = (key < node->key) ? node->left : node->right;
     }
+
+    if (node == nullptr) return false;
+
+    detach(node);
+    deleteObject(memoryResource, node);
+    return true;
 }
 
 /**
- * @brief Removes node and returns new subtree root
+ * @brief Links an entry's embedded treeLinks under entry->key unless the key is already present.
  *
- * @param root Current subtree root
- * @param key Key to remove
- * @return TreeNode* New subtree root
+ * @param entry The entry to link; its treeLinks key and fifoNode are set from the entry.
+ * @return True if the entry was linked, false if its key was already present.
  */
-TreeNode* SelfBalancingTree::removeRB(TreeNode* node, int key) {
-    if (node == nullptr) return nullptr;
+bool SelfBalancingTree::attach(CacheEntry* entry) {
+    entry->treeLinks.key = entry->key;
+    entry->treeLinks.fifoNode = entry;
 
-    if (key < node->key) {
-        node->left = removeRB(node->left, key);
-        if (node->left != nullptr) node->left->parent = node;
-    } else if (key > node->key) {
-        node->right = removeRB(node->right, key);
-        if (node->right != nullptr) node->right->parent = node;
-    } else {
-        if (node->left == nullptr && node->right == nullptr) {
-            if (getColor(node) == BLACK) {
-                fixDeletion(node);
-            }
-            delete node;
-            return nullptr;
-        }
+    bool inserted;
+    findOrAttach(&entry->treeLinks, inserted);
+    return inserted;
+}
 
-        if (node->left == nullptr) {
-            TreeNode* temp = node->right;
-            if (getColor(node) == BLACK && getColor(temp) == RED) {
-                setColor(temp, BLACK);
-            }
-            temp->parent = node->parent;
-            delete node;
-            return temp;
-        }
-        if (node->right == nullptr) {
-            TreeNode* temp = node->left;
-            if (getColor(node) == BLACK && getColor(temp) == RED) {
-                setColor(temp, BLACK);
-            }
-            temp->parent = node->parent;
-            delete node;
-            return temp;
-        }
+/**
+ * @brief Links a batch of entries into an empty tree, building it balanced in linear time.
+ *
+ * Each entry's treeLinks key and fifoNode are set from the entry, as attach does.
+ *
+ * @param entries The entries to link, in strictly ascending key order.
+ * @param count The number of entries.
+ * @return True if the batch was linked; false, with nothing linked, if the tree is not empty
+ * or the keys are not strictly ascending.
+ */
+bool SelfBalancingTree::attachSorted(CacheEntry* const* entries, int count) {
+    if (root != nullptr) return false;
 
-        TreeNode* successor = findMin(node->right);
-        node->key = successor->key;
-        node->fifoNode = successor->fifoNode;
-        node->right = removeRB(node->right, successor->key);
-        if (node->right != nullptr) node->right->parent = node;
+    // One pass checks the order and readies the links; links readied before a failed check are unused
+    for (int i = 0; i < count; i++) {
+        if (i > 0 && entries[i - 1]->key >= entries[i]->key) return false;
+
+        entries[i]->treeLinks.key = entries[i]->key;
+        entries[i]->treeLinks.fifoNode = entries[i];
     }
 
-    updateNodeCounts(node);
-    return node;
+    // The tree is built straight from the entries' embedded links
+    auto linksAt = [entries](int i) { return &entries[i]->treeLinks; };
+    buildFromSorted(linksAt, count);
+    return true;
 }
 
 /**
- * @brief Removes a node with the specified key from the tree.
+ * @brief Builds an empty tree from sorted keys in linear time, as many addToTree calls would.
  *
- * @param key The key of the node to remove.
- * @return True if the node was removed, false if the key wasn't found.
+ * @param keys The keys to add, in strictly ascending order.
+ * @param dllNodes The DllNode to link with each key.
+ * @param count The number of keys.
+ * @return True if the keys were added; false, with nothing added, if the tree is not empty
+ * or the keys are not strictly ascending.
  */
-bool SelfBalancingTree::removeNode(int key) {
-    if (!contains(key)) return false;
-
-    root = removeRB(root, key);
+bool SelfBalancingTree::addSorted(const int* keys, DllNode* const* dllNodes, int count) {
+    if (root != nullptr) return false;
 
-    if (root != nullptr) {
-        setColor(root, BLACK);
-        root->parent = nullptr;
+    for (int i = 1; i < count; i++) {
+        if (keys[i - 1] >= keys[i]) return false;
     }
 
+    // Each node is made when the build reaches its index, so no array of nodes is needed
+    auto newNodeAt = [this, keys, dllNodes](int i) {
+        return newObject<TreeNode>(memoryResource, keys[i], 1, 0, BLACK, nullptr, nullptr, nullptr, dllNodes[i]);
+    };
+    buildFromSorted(newNodeAt, count);
     return true;
 }
 
+/**
+ * @brief Unlinks an entry's treeLinks from the tree and rebalances, without deleting anything.
+ *
+ * @param entry An entry currently linked in this tree.
+ */
+void SelfBalancingTree::detach(CacheEntry* entry) {
+    detach(&entry->treeLinks);
+}
+
+/**
+ * @brief Unlinks a node from the tree and rebalances, without deleting it.
+ *
+ * A node with two children first trades places (links, color and count) with its in-order
+ * successor, so it has at most one child when it is unlinked; no key or payload moves
+ * between nodes. The tree is rebalanced after unlinking.
+ *
+ * @param node A node currently linked in this tree.
+ */
+void SelfBalancingTree::detach(TreeNode* node) {
+    if (node->left != nullptr && node->right != nullptr) {
+        TreeNode* successor = findMin(node->right);
+        TreeNode* nodeParent = node->parent;
+        TreeNode* successorRight = successor->right;
+
+        replaceChild(nodeParent, node, successor);
+
+        if (successor == node->right) {
+            successor->right = node;
+            node->parent = successor;
+        } else {
+            TreeNode* successorParent = successor->parent;
+            successor->right = node->right;
+            successor->right->parent = successor;
+            successorParent->left = node;
+            node->parent = successorParent;
+        }
+
+        successor->parent = nodeParent;
+        successor->left = node->left;
+        successor->left->parent = successor;
+
+        node->left = nullptr;
+        node->right = successorRight;
+        if (successorRight != nullptr) successorRight->parent = node;
+
+        std::swap(node->color, successor->color);
+        std::swap(node->numberOfNodes, successor->numberOfNodes);
+    }
+
+    TreeNode* child = (node->left != nullptr) ? node->left : node->right;
+    TreeNode* parent = node->parent;
+
+    if (child != nullptr) child->parent = parent;
+    replaceChild(parent, node, child);
+
+    for (TreeNode* ancestor = parent; ancestor != nullptr; ancestor = ancestor->parent) {
+        ancestor->numberOfNodes--;
+    }
+
+    if (node->color == BLACK) {
+        fixDeletion(child, parent);
+    }
+
+    node->left = nullptr;
+    node->right = nullptr;
+    node->parent = nullptr;
+    node->numberOfNodes = 1;
+}
+
 /**
  * @brief Gets the height of the tree.
  *
@@ -504,6 +647,15 @@ int SelfBalancingTree::getNumberOfTreeNodes() const {
     return root->numberOfNodes;
 }
 
+/**
+ * @brief Gets the number of keys in the tree; the same as getNumberOfTreeNodes.
+ *
+ * @return The number of keys in the tree.
+ */
+int SelfBalancingTree::getNumberOfItems() const {
+    return getNumberOfTreeNodes();
+}
+
 /**
  * @brief Checks if the tree contains a node with the specified key.
  *
@@ -511,19 +663,215 @@ int SelfBalancingTree::getNumberOfTreeNodes() const {
  * @return True if the key exists in the tree, false otherwise.
  */
 bool SelfBalancingTree::contains(int key) const {
+    return peek(key) != nullptr;
+}
+
+/**
+ * @brief Finds the node with the specified key without changing the tree.
+ *
+ * @param key The key to search for in the tree.
+ * @return The node holding key, or nullptr if the key is not in the tree.
+ */
+TreeNode* SelfBalancingTree::peek(int key) const {
     TreeNode* current = root;
 
+    while (current != nullptr && key != current->key) {
+        current = (key < current->key) ? current->left : current->right;
+    }
+
+    return current;
+}
+
+/**
+ * @brief Finds the FIFO node linked under the specified key.
+ *
+ * @param key The key to search for in the tree.
+ * @return The key's FIFO node, or nullptr if the key is not in the tree.
+ */
+DllNode* SelfBalancingTree::find(int key) const {
+    TreeNode* node = peek(key);
+    return (node != nullptr) ? node->fifoNode : nullptr;
+}
+
+/**
+ * @brief Copies the FIFO nodes of the keys in [low, high] in ascending order, without printing.
+ *
+ * @param low The lower bound (inclusive) of the range.
+ * @param high The upper bound (inclusive) of the range.
+ * @param results Array of at least maxResults pointers to fill.
+ * @param maxResults Most nodes to copy; the scan stops there.
+ * @return The number of nodes copied.
+ */
+int SelfBalancingTree::collectRange(int low, int high, DllNode** results, int maxResults) const {
+    // One descent finds the smallest key >= low; successor then walks up and down the parent links
+    TreeNode* first = nullptr;
+    TreeNode* current = root;
     while (current != nullptr) {
-        if (key == current->key) {
-            return true;
-        } else if (key < current->key) {
+        if (current->key >= low) {
+            first = current;
+            current = current->left;
+        } else {
+            current = current->right;
+        }
+    }
+
+    int count = 0;
+    for (current = first; current != nullptr && current->key <= high && count < maxResults; current = successor(current)) {
+        results[count++] = current->fifoNode;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Finds the node with the next smaller key, using the parent links
+ *
+ * @param node A node in the tree
+ * @return TreeNode* The in-order predecessor, or nullptr if node holds the smallest key
+ */
+TreeNode* SelfBalancingTree::predecessor(TreeNode* node) const {
+    if (node->left != nullptr) {
+        node = node->left;
+        while (node->right != nullptr) {
+            node = node->right;
+        }
+        return node;
+    }
+
+    // Climb until coming up from a right child; that parent is the previous key
+    TreeNode* parent = node->parent;
+    while (parent != nullptr && node == parent->left) {
+        node = parent;
+        parent = parent->parent;
+    }
+
+    return parent;
+}
+
+/**
+ * @brief Points a cursor at node if node's key is within the cursor's bounds, otherwise ends it
+ *
+ * @param cursor The cursor to update
+ * @param node The node to move to (may be nullptr)
+ */
+static void moveCursor(RangeCursor& cursor, const TreeNode* node) {
+    if (node == nullptr || node->key < cursor.low || node->key > cursor.high) {
+        cursor.node = nullptr;
+        return;
+    }
+
+    cursor.node = node;
+    cursor.key = node->key;
+    cursor.fifoNode = node->fifoNode;
+}
+
+/**
+ * @brief Puts a cursor on the first key of its range in its direction, in one descent.
+ *
+ * @param cursor A cursor whose index, bounds and direction are set; it is invalid if the range is empty.
+ */
+void SelfBalancingTree::seekRange(RangeCursor& cursor) const {
+    // Ascending wants the smallest key >= low; descending the largest key <= high
+    TreeNode* first = nullptr;
+    TreeNode* current = root;
+    while (current != nullptr) {
+        if (cursor.ascending ? (current->key >= cursor.low) : (current->key > cursor.high)) {
+            if (cursor.ascending) first = current;
+            current = current->left;
+        } else {
+            if (!cursor.ascending) first = current;
+            current = current->right;
+        }
+    }
+
+    moveCursor(cursor, first);
+}
+
+/**
+ * @brief Moves a valid cursor to the in-order successor or predecessor of its node.
+ *
+ * @param cursor The cursor to move; it is invalid once it passes its bound.
+ */
+void SelfBalancingTree::stepRange(RangeCursor& cursor) const {
+    TreeNode* node = static_cast<TreeNode*>(const_cast<void*>(cursor.node));
+
+    moveCursor(cursor, cursor.ascending ? successor(node) : predecessor(node));
+}
+
+/**
+ * @brief Counts the keys below key, or at or below it
+ *
+ * @param key The bound
+ * @param inclusive True to count keys <= key, false to count keys < key
+ * @return int The number of keys counted
+ */
+int SelfBalancingTree::countBelow(int key, bool inclusive) const {
+    int count = 0;
+    TreeNode* current = root;
+
+    // Stepping right passes a node and its whole left subtree, all of them counted
+    while (current != nullptr) {
+        if (current->key < key || (inclusive && current->key == key)) {
+            count += ((current->left != nullptr) ? current->left->numberOfNodes : 0) + 1;
+            current = current->right;
+        } else {
+            current = current->left;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief Counts the keys smaller than key, in one descent over the subtree counts.
+ *
+ * @param key The key to rank; it need not be in the tree.
+ * @return The number of keys < key, which is key's 0-based position if it is present.
+ */
+int SelfBalancingTree::rank(int key) const {
+    return countBelow(key, false);
+}
+
+/**
+ * @brief Finds the key at a 0-based position in ascending order, in one descent.
+ *
+ * @param index The position, 0 for the smallest key.
+ * @return The key's FIFO node, or nullptr if index is not in [0, getNumberOfTreeNodes()).
+ */
+DllNode* SelfBalancingTree::select(int index) const {
+    if (index < 0 || index >= getNumberOfTreeNodes()) {
+        return nullptr;
+    }
+
+    TreeNode* current = root;
+
+    for (;;) {
+        int leftCount = (current->left != nullptr) ? current->left->numberOfNodes : 0;
+
+        if (index < leftCount) {
             current = current->left;
+        } else if (index == leftCount) {
+            return current->fifoNode;
         } else {
+            index -= leftCount + 1;
             current = current->right;
         }
     }
+}
+
+/**
+ * @brief Counts the keys in [low, high] as the difference of two descents.
+ *
+ * @param low The lower bound (inclusive) of the range.
+ * @param high The upper bound (inclusive) of the range.
+ * @return The number of keys in the range; 0 if low > high.
+ */
+int SelfBalancingTree::countInRange(int low, int high) const {
+    if (low > high) {
+        return 0;
+    }
 
-    return false;
+    return countBelow(high, true) - countBelow(low, false);
 }
 
 /**
@@ -554,6 +902,13 @@ void SelfBalancingTree::clear() {
     root = nullptr;
 }
 
+/**
+ * @brief Empties the tree without deleting any node; for trees whose nodes are owned elsewhere.
+ */
+void SelfBalancingTree::detachAll() {
+    root = nullptr;
+}
+
 /**
  * @brief Deletes the tree starting from the specified node.
  *
@@ -566,7 +921,7 @@ void SelfBalancingTree::deleteTree(TreeNode* node) {
 
     deleteTree(node->left);
     deleteTree(node->right);
-    delete node;
+    deleteObject(memoryResource, node);
 }
 
 /**
@@ -1,336 +1,571 @@
-/**
-* @author - Hugh Hui, Adrian Aquino
-* @file self_balancing_tree.h  -  This header file declares the methods in the self_balancing_tree.cpp file.
-* 1/14/2025 - H. Hui created file and added comments.
-* 1/15/2025 - modified by H. Hui; modified remove methods; added comments
-* 2/1/2025 - H. Hui added doxygen formatted comments
-* 5/17/2025 - Modified by Adrian Aquino; renamed binary_search_tree.h to self_balancing_tree.h and added red-black tree functionality
-* 5/21/2025 - Modified by Adrian Aquino; updated red-black tree implementation with proper color handling and parent pointers
-*/
-
-#ifndef SELFBALANCING_TREE_H
-#define SELFBALANCING_TREE_H
-
-#include "tree_node.h"
-
-/**
- * @class SelfBalancingTree
- * @brief A class representing a Self-Balancing Tree using Red-Black algorithm.
- *
- * This class provides methods to manipulate and traverse a self-balancing tree.
- * It supports operations like adding and removing nodes, checking if a key exists,
- * calculating the height of the tree, and printing the tree in various traversal orders.
- */
-class SelfBalancingTree {
-public:
-    /**
-     * @brief Default constructor for SelfBalancingTree.
-     *
-     * Initializes an empty self-balancing tree.
-     */
-    SelfBalancingTree();
-
-    /**
-     * @brief Destructor for SelfBalancingTree.
-     *
-     * Frees the dynamically allocated memory by deleting all nodes in the tree.
-     */
-    ~SelfBalancingTree();
-
-    /**
-     * @brief Adds a node with the specified key to the tree.
-     *
-     * @param key The key to be added to the tree.
-     * @param dllNode Pointer to the DllNode to be linked with this tree node.
-     */
-    void addToTree(int key, DllNode* dllNode);
-
-    /**
-     * @brief Removes a node with the specified key from the tree.
-     *
-     * @param key The key of the node to remove.
-     * @return True if the node was removed, false if the key wasn't found.
-     */
-    bool removeNode(int key);
-
-    /**
-     * @brief Gets the height of the tree.
-     *
-     * The height of the tree is defined as the length of the longest path from
-     * the root to a leaf node.
-     *
-     * @return The height of the tree.
-     */
-    int getHeightOfTree() const;
-
-    /**
-     * @brief Gets the number of nodes in the tree.
-     *
-     * @return The number of nodes in the tree.
-     */
-    int getNumberOfTreeNodes() const;
-
-    /**
-     * @brief Checks if the tree contains a node with the specified key.
-     *
-     * @param key The key to search for in the tree.
-     * @return True if the key exists in the tree, false otherwise.
-     */
-    bool contains(int key) const;
-
-    /**
-     * @brief Gets the root node of the tree.
-     *
-     * @return A pointer to the root node of the tree.
-     */
-    TreeNode* getRoot() const;
-
-    /**
-     * @brief Checks if the tree is empty.
-     *
-     * @return True if the tree is empty, false otherwise.
-     */
-    bool isEmpty() const;
-
-    /**
-     * @brief Clears the entire tree.
-     *
-     * Deletes all the nodes in the tree, freeing up memory.
-     */
-    void clear();
-
-    /**
-     * @brief Prints the data of a specific node.
-     *
-     * This function prints the key, number of nodes in the subtree, and height of the given node.
-     *
-     * @param node A pointer to the node whose data is to be printed.
-     */
-    void printNodeFromTree(TreeNode* node) const;
-
-    /**
-     * @brief Performs an in-order traversal of the tree and prints the nodes.
-     *
-     * In-order traversal visits the left subtree, the node, and then the right subtree.
-     */
-    void printInOrder() const;
-
-    /**
-     * @brief Performs an reverse traversal of the tree and prints the nodes.
-     *
-     * Reverse traversal visits the right subtree, the node, and then the left subtree.
-     */
-    void printReverseOrder() const;
-
-    /**
-     * @brief Performs a pre-order traversal of the tree and prints the nodes.
-     *
-     * Pre-order traversal visits the node, the left subtree, and then the right subtree.
-     */
-    void printPreOrder() const;
-
-    /**
-     * @brief Performs a post-order traversal of the tree and prints the nodes.
-     *
-     * Post-order traversal visits the left subtree, the right subtree, and then the node.
-     */
-    void printPostOrder() const;
-
-    /**
-     * @brief Performs a depth-first traversal (same as pre-order traversal) and prints the nodes.
-     *
-     * Depth-first traversal visits the node first, then the left subtree, and then the right subtree.
-     */
-    void printDepthFirst() const;
-
-    /**
-     * @brief Performs a breadth-first traversal of the tree and prints the nodes.
-     *
-     * Breadth-first traversal visits nodes level by level, from left to right.
-     */
-    void printBreadthFirst() const;
-
-    /**
-    *
-    * printRange
-    *
-    * Method to traverse and print out the cache information given a low and high value.
-    *
-    * @param    low			the lower bound (inclusive) of the range to print
-    * @param	high		the higher bound (inclusive) of the range to print
-    *
-    * @return   nothing, but prints out the keys for the cache between low and high
-    */
-    void printRange(int low, int high);
-
-private:
-    TreeNode* root; /**< Pointer to the root node of the tree */
-
-    /**
-     * @brief Deletes the tree starting from the specified node.
-     *
-     * Recursively deletes all nodes in the tree.
-     *
-     * @param node The starting node to begin deleting the tree.
-     */
-    void deleteTree(TreeNode* node);
-
-    /**
-     * @brief Helper function to calculate the height of a node.
-     *
-     * This function is used by `getHeightOfTree` to calculate the height of the tree.
-     *
-     * @param node A pointer to the node whose height is to be calculated.
-     * @return The height of the given node.
-     */
-    int getHeight(TreeNode* node) const;
-
-    /**
-     * @brief Helper function for recursive in-order traversal.
-     *
-     * This function is called recursively to perform an in-order traversal starting from the given node.
-     *
-     * @param node A pointer to the node from which to begin the in-order traversal.
-     */
-    void printInOrderHelper(TreeNode* node) const;
-
-    /**
-     * @brief Helper function for recursive in-order traversal.
-     *
-     * This function is called recursively to perform an in-order traversal starting from the given node.
-     *
-     * @param node A pointer to the node from which to begin the in-order traversal.
-     */
-    void printReverseOrderHelper(TreeNode* node) const;
-
-    /**
-     * @brief Helper function for recursive pre-order traversal.
-     *
-     * This function is called recursively to perform a pre-order traversal starting from the given node.
-     *
-     * @param node A pointer to the node from which to begin the pre-order traversal.
-     */
-    void printPreOrderHelper(TreeNode* node) const;
-
-    /**
-     * @brief Helper function for recursive post-order traversal.
-     *
-     * This function is called recursively to perform a post-order traversal starting from the given node.
-     *
-     * @param node A pointer to the node from which to begin the post-order traversal.
-     */
-    void printPostOrderHelper(TreeNode* node) const;
-
-    /**
-    *
-    * printRange
-    *
-    * Method to traverse and print out the cache information given a low and high value.
-    *
-    * @param    node        the current node being examined
-    * @param    low			the lower bound (inclusive) of the range to print
-    * @param	high		the higher bound (inclusive) of the range to print
-    *
-    * @return   nothing, but prints out the keys for the cache between low and high
-    */
-    void printRangeHelper(TreeNode* node, int low, int high);
-
-    /**
-     * @brief Rotates a subtree left
-     *
-     * @param x Root of subtree to rotate
-     * @return TreeNode* New root after rotation
-     */
-    TreeNode* rotateLeft(TreeNode* x);
-
-    /**
-     * @brief Rotates a subtree right
-     *
-     * @param y Root of subtree to rotate
-     * @return TreeNode* New root after rotation
-     */
-    TreeNode* rotateRight(TreeNode* y);
-
-    /**
-     * @brief Inserts node and returns new subtree root
-     *
-     * @param root Current subtree root
-     * @param key Key to insert
-     * @param dllNode FIFO node to link
-     * @return TreeNode* New subtree root
-     */
-    TreeNode* insertRB(TreeNode* root, int key, DllNode* dllNode);
-
-    /**
-     * @brief Removes node and returns new subtree root
-     *
-     * @param root Current subtree root
-     * @param key Key to remove
-     * @return TreeNode* New subtree root
-     */
-    TreeNode* removeRB(TreeNode* root, int key);
-
-    /**
-     * @brief Finds minimum key node in subtree
-     *
-     * @param node Root of subtree
-     * @return TreeNode* Node with minimum key
-     */
-    TreeNode* findMin(TreeNode* node) const;
-
-    /**
-     * @brief Finds node with specified key
-     *
-     * @param node Root of subtree to search
-     * @param key Key to find
-     * @return TreeNode* Node with key, or nullptr
-     */
-    TreeNode* findNode(TreeNode* node, int key) const;
-
-    /**
-     * @brief Updates node counts for a given node
-     *
-     * @param node Node to update
-     */
-    void updateNodeCounts(TreeNode* node);
-
-    /**
-     * @brief Checks if node is red
-     *
-     * @param node Node to check
-     * @return bool True if red, false if black or null
-     */
-    bool isRed(TreeNode* node) const;
-
-    /**
-     * @brief Gets color of a node
-     *
-     * @param node The node to check
-     * @return Color Color of the node
-     */
-    Color getColor(TreeNode* node) const;
-
-    /**
-     * @brief Sets color of a node
-     *
-     * @param node The node to modify
-     * @param color Color to set
-     */
-    void setColor(TreeNode* node, Color color);
-
-    /**
-     * @brief Fixes Red-Black properties after insertion
-     *
-     * @param node Node that was inserted
-     */
-    void fixInsertion(TreeNode* node);
-
-    /**
-     * @brief Fixes Red-Black properties after deletion
-     *
-     * @param node Node being fixed
-     */
-    void fixDeletion(TreeNode* node);
-};
-
+/**
+* @author - Hugh Hui, Adrian Aquino
+* @file self_balancing_tree.h  -  This header file declares the methods in the self_balancing_tree.cpp file.
+* 1/14/2025 - H. Hui created file and added comments.
+* 1/15/2025 - modified by H. Hui; modified remove methods; added comments
+* 2/1/2025 - H. Hui added doxygen formatted comments
+* 5/17/2025 - Modified by Adrian Aquino; renamed binary_search_tree.h to self_balancing_tree.h and added red-black tree functionality
+* 5/21/2025 - Modified by Adrian Aquino; updated red-black tree implementation with proper color handling and parent pointers
+* 10/18/26 - Added findOrInsert and replaceChild; insertRB and removeRB replaced by single iterative descents
+* 10/18/26 - Added findOrAttach, detach and detachAll for tree nodes embedded in a CacheEntry
+* 10/18/26 - Nodes the tree allocates itself come from an optional std::pmr::memory_resource
+* 10/18/26 - Added peek
+* 10/18/26 - Implements OrderedIndex: added getNumberOfItems, attach, detach(CacheEntry*), find and collectRange
+* 10/18/26 - Added rank, select and countInRange on the numberOfNodes subtree counts
+* 10/18/26 - fixInsertion and findNode are iterative
+* 10/18/26 - Added seekRange and stepRange for RangeCursor, and predecessor
+* 10/18/26 - Added attachSorted and addSorted, which build a balanced tree from sorted keys in linear time
+* 10/18/26 - buildBalanced takes the nodes through an accessor, so the bulk builds need no node array
+*/
+
+#ifndef SELFBALANCING_TREE_H
+#define SELFBALANCING_TREE_H
+
+#include "tree_node.h"
+#include "ordered_index.h"
+#include "memory_resources.h"
+
+/**
+ * @class SelfBalancingTree
+ * @brief A class representing a Self-Balancing Tree using Red-Black algorithm.
+ *
+ * This class provides methods to manipulate and traverse a self-balancing tree.
+ * It supports operations like adding and removing nodes, checking if a key exists,
+ * calculating the height of the tree, and printing the tree in various traversal orders.
+ * As CacheManager's RED_BLACK_TREE ordered index it links each entry's embedded treeLinks.
+ */
+class SelfBalancingTree : public OrderedIndex {
+public:
+    /**
+     * @brief Default constructor for SelfBalancingTree.
+     *
+     * Initializes an empty self-balancing tree.
+     *
+     * @param resource Memory resource for the nodes findOrInsert allocates (nullptr = new/delete).
+     */
+    SelfBalancingTree(std::pmr::memory_resource* resource = nullptr);
+
+    /**
+     * @brief Destructor for SelfBalancingTree.
+     *
+     * Frees the dynamically allocated memory by deleting all nodes in the tree.
+     */
+    ~SelfBalancingTree();
+
+    /**
+     * @brief Adds a node with the specified key to the tree.
+     *
+     * @param key The key to be added to the tree.
+     * @param dllNode Pointer to the DllNode to be linked with this tree node.
+     */
+    void addToTree(int key, DllNode* dllNode);
+
+    /**
+     * @brief Finds the node with key, inserting and rebalancing if it is absent, in one descent.
+     *
+     * @param key The key to look up or insert.
+     * @param dllNode FIFO node to link if a new node is created; an existing node is left unchanged.
+     * @param inserted Set to true if a node was created, false if key was already present.
+     * @return TreeNode* The node holding key.
+     */
+    TreeNode* findOrInsert(int key, DllNode* dllNode, bool& inserted);
+
+    /**
+     * @brief Links a caller-owned node into the tree unless its key is already present.
+     *
+     * The node's links, color and count are reset; the tree never deletes it.
+     *
+     * @param node The node to link, keyed by node->key (e.g. a CacheEntry's treeLinks).
+     * @param inserted Set to true if node was linked, false if its key was already present.
+     * @return TreeNode* The node holding the key (node itself when inserted).
+     */
+    TreeNode* findOrAttach(TreeNode* node, bool& inserted);
+
+    /**
+     * @brief Unlinks a node from the tree and rebalances, without deleting it.
+     *
+     * The node itself is spliced out, so every other node stays where its owner left it.
+     *
+     * @param node A node currently linked in this tree.
+     */
+    void detach(TreeNode* node);
+
+    /**
+     * @brief Links an entry's embedded treeLinks under entry->key unless the key is already present.
+     *
+     * @param entry The entry to link; its treeLinks key and fifoNode are set from the entry.
+     * @return True if the entry was linked, false if its key was already present.
+     */
+    bool attach(CacheEntry* entry);
+
+    /**
+     * @brief Links a batch of entries into an empty tree, building it balanced in linear time.
+     *
+     * Each entry's treeLinks key and fifoNode are set from the entry, as attach does.
+     *
+     * @param entries The entries to link, in strictly ascending key order.
+     * @param count The number of entries.
+     * @return True if the batch was linked; false, with nothing linked, if the tree is not empty
+     * or the keys are not strictly ascending.
+     */
+    bool attachSorted(CacheEntry* const* entries, int count);
+
+    /**
+     * @brief Builds an empty tree from sorted keys in linear time, as many addToTree calls would.
+     *
+     * @param keys The keys to add, in strictly ascending order.
+     * @param dllNodes The DllNode to link with each key.
+     * @param count The number of keys.
+     * @return True if the keys were added; false, with nothing added, if the tree is not empty
+     * or the keys are not strictly ascending.
+     */
+    bool addSorted(const int* keys, DllNode* const* dllNodes, int count);
+
+    /**
+     * @brief Unlinks an entry's treeLinks from the tree and rebalances, without deleting anything.
+     *
+     * @param entry An entry currently linked in this tree.
+     */
+    void detach(CacheEntry* entry);
+
+    /**
+     * @brief Removes a node with the specified key from the tree.
+     *
+     * @param key The key of the node to remove.
+     * @return True if the node was removed, false if the key wasn't found.
+     */
+    bool removeNode(int key);
+
+    /**
+     * @brief Gets the height of the tree.
+     *
+     * The height of the tree is defined as the length of the longest path from
+     * the root to a leaf node.
+     *
+     * @return The height of the tree.
+     */
+    int getHeightOfTree() const;
+
+    /**
+     * @brief Gets the number of nodes in the tree.
+     *
+     * @return The number of nodes in the tree.
+     */
+    int getNumberOfTreeNodes() const;
+
+    /**
+     * @brief Gets the number of keys in the tree; the same as getNumberOfTreeNodes.
+     *
+     * @return The number of keys in the tree.
+     */
+    int getNumberOfItems() const;
+
+    /**
+     * @brief Checks if the tree contains a node with the specified key.
+     *
+     * @param key The key to search for in the tree.
+     * @return True if the key exists in the tree, false otherwise.
+     */
+    bool contains(int key) const;
+
+    /**
+     * @brief Finds the node with the specified key without changing the tree.
+     *
+     * @param key The key to search for in the tree.
+     * @return The node holding key, or nullptr if the key is not in the tree.
+     */
+    TreeNode* peek(int key) const;
+
+    /**
+     * @brief Finds the FIFO node linked under the specified key.
+     *
+     * @param key The key to search for in the tree.
+     * @return The key's FIFO node, or nullptr if the key is not in the tree.
+     */
+    DllNode* find(int key) const;
+
+    /**
+     * @brief Copies the FIFO nodes of the keys in [low, high] in ascending order, without printing.
+     *
+     * @param low The lower bound (inclusive) of the range.
+     * @param high The upper bound (inclusive) of the range.
+     * @param results Array of at least maxResults pointers to fill.
+     * @param maxResults Most nodes to copy; the scan stops there.
+     * @return The number of nodes copied.
+     */
+    int collectRange(int low, int high, DllNode** results, int maxResults) const;
+
+    /**
+     * @brief Counts the keys smaller than key, in one descent over the subtree counts.
+     *
+     * @param key The key to rank; it need not be in the tree.
+     * @return The number of keys < key, which is key's 0-based position if it is present.
+     */
+    int rank(int key) const;
+
+    /**
+     * @brief Finds the key at a 0-based position in ascending order, in one descent.
+     *
+     * @param index The position, 0 for the smallest key.
+     * @return The key's FIFO node, or nullptr if index is not in [0, getNumberOfTreeNodes()).
+     */
+    DllNode* select(int index) const;
+
+    /**
+     * @brief Counts the keys in [low, high] as the difference of two descents.
+     *
+     * @param low The lower bound (inclusive) of the range.
+     * @param high The upper bound (inclusive) of the range.
+     * @return The number of keys in the range; 0 if low > high.
+     */
+    int countInRange(int low, int high) const;
+
+    /**
+     * @brief Puts a cursor on the first key of its range in its direction, in one descent.
+     *
+     * @param cursor A cursor whose index, bounds and direction are set; it is invalid if the range is empty.
+     */
+    void seekRange(RangeCursor& cursor) const;
+
+    /**
+     * @brief Moves a valid cursor to the in-order successor or predecessor of its node.
+     *
+     * @param cursor The cursor to move; it is invalid once it passes its bound.
+     */
+    void stepRange(RangeCursor& cursor) const;
+
+    /**
+     * @brief Gets the root node of the tree.
+     *
+     * @return A pointer to the root node of the tree.
+     */
+    TreeNode* getRoot() const;
+
+    /**
+     * @brief Checks if the tree is empty.
+     *
+     * @return True if the tree is empty, false otherwise.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Clears the entire tree.
+     *
+     * Deletes all the nodes in the tree, freeing up memory.
+     */
+    void clear();
+
+    /**
+     * @brief Empties the tree without deleting any node; for trees whose nodes are owned elsewhere.
+     */
+    void detachAll();
+
+    /**
+     * @brief Prints the data of a specific node.
+     *
+     * This function prints the key, number of nodes in the subtree, and height of the given node.
+     *
+     * @param node A pointer to the node whose data is to be printed.
+     */
+    void printNodeFromTree(TreeNode* node) const;
+
+    /**
+     * @brief Performs an in-order traversal of the tree and prints the nodes.
+     *
+     * In-order traversal visits the left subtree, the node, and then the right subtree.
+     */
+    void printInOrder() const;
+
+    /**
+     * @brief Performs an reverse traversal of the tree and prints the nodes.
+     *
+     * Reverse traversal visits the right subtree, the node, and then the left subtree.
+     */
+    void printReverseOrder() const;
+
+    /**
+     * @brief Performs a pre-order traversal of the tree and prints the nodes.
+     *
+     * Pre-order traversal visits the node, the left subtree, and then the right subtree.
+     */
+    void printPreOrder() const;
+
+    /**
+     * @brief Performs a post-order traversal of the tree and prints the nodes.
+     *
+     * Post-order traversal visits the left subtree, the right subtree, and then the node.
+     */
+    void printPostOrder() const;
+
+    /**
+     * @brief Performs a depth-first traversal (same as pre-order traversal) and prints the nodes.
+     *
+     * Depth-first traversal visits the node first, then the left subtree, and then the right subtree.
+     */
+    void printDepthFirst() const;
+
+    /**
+     * @brief Performs a breadth-first traversal of the tree and prints the nodes.
+     *
+     * Breadth-first traversal visits nodes level by level, from left to right.
+     */
+    void printBreadthFirst() const;
+
+    /**
+    *
+    * printRange
+    *
+    * Method to traverse and print out the cache information given a low and high value.
+    *
+    * @param    low			the lower bound (inclusive) of the range to print
+    * @param	high		the higher bound (inclusive) of the range to print
+    *
+    * @return   nothing, but prints out the keys for the cache between low and high
+    */
+    void printRange(int low, int high);
+
+private:
+    TreeNode* root; /**< Pointer to the root node of the tree */
+    std::pmr::memory_resource* memoryResource; /**< Source of the nodes the tree allocates; nullptr = new/delete */
+
+    /**
+     * @brief Deletes the tree starting from the specified node.
+     *
+     * Recursively deletes all nodes in the tree.
+     *
+     * @param node The starting node to begin deleting the tree.
+     */
+    void deleteTree(TreeNode* node);
+
+    /**
+     * @brief Helper function to calculate the height of a node.
+     *
+     * This function is used by `getHeightOfTree` to calculate the height of the tree.
+     *
+     * @param node A pointer to the node whose height is to be calculated.
+     * @return The height of the given node.
+     */
+    int getHeight(TreeNode* node) const;
+
+    /**
+     * @brief Helper function for recursive in-order traversal.
+     *
+     * This function is called recursively to perform an in-order traversal starting from the given node.
+     *
+     * @param node A pointer to the node from which to begin the in-order traversal.
+     */
+    void printInOrderHelper(TreeNode* node) const;
+
+    /**
+     * @brief Helper function for recursive in-order traversal.
+     *
+     * This function is called recursively to perform an in-order traversal starting from the given node.
+     *
+     * @param node A pointer to the node from which to begin the in-order traversal.
+     */
+    void printReverseOrderHelper(TreeNode* node) const;
+
+    /**
+     * @brief Helper function for recursive pre-order traversal.
+     *
+     * This function is called recursively to perform a pre-order traversal starting from the given node.
+     *
+     * @param node A pointer to the node from which to begin the pre-order traversal.
+     */
+    void printPreOrderHelper(TreeNode* node) const;
+
+    /**
+     * @brief Helper function for recursive post-order traversal.
+     *
+     * This function is called recursively to perform a post-order traversal starting from the given node.
+     *
+     * @param node A pointer to the node from which to begin the post-order traversal.
+     */
+    void printPostOrderHelper(TreeNode* node) const;
+
+    /**
+    *
+    * printRange
+    *
+    * Method to traverse and print out the cache information given a low and high value.
+    *
+    * @param    node        the current node being examined
+    * @param    low			the lower bound (inclusive) of the range to print
+    * @param	high		the higher bound (inclusive) of the range to print
+    *
+    * @return   nothing, but prints out the keys for the cache between low and high
+    */
+    void printRangeHelper(TreeNode* node, int low, int high);
+
+    /**
+     * @brief Rotates a subtree left
+     *
+     * @param x Root of subtree to rotate
+     * @return TreeNode* New root after rotation
+     */
+    TreeNode* rotateLeft(TreeNode* x);
+
+    /**
+     * @brief Rotates a subtree right
+     *
+     * @param y Root of subtree to rotate
+     * @return TreeNode* New root after rotation
+     */
+    TreeNode* rotateRight(TreeNode* y);
+
+    /**
+     * @brief Points the link that held oldChild at newChild
+     *
+     * @param parent Parent of oldChild before the rotation, or nullptr if oldChild was the root
+     * @param oldChild Previous root of the subtree
+     * @param newChild New root of the subtree
+     */
+    void replaceChild(TreeNode* parent, TreeNode* oldChild, TreeNode* newChild);
+
+    /**
+     * @brief Links a new red node under parent, updates the subtree counts and rebalances.
+     *
+     * @param parent The node the descent stopped at (nullptr for an empty tree).
+     * @param newNode The node to link; its key is not present in the tree.
+     */
+    void linkNewNode(TreeNode* parent, TreeNode* newNode);
+
+    /**
+     * @brief Finds minimum key node in subtree
+     *
+     * @param node Root of subtree
+     * @return TreeNode* Node with minimum key
+     */
+    TreeNode* findMin(TreeNode* node) const;
+
+    /**
+     * @brief Finds the node with the next larger key
+     *
+     * @param node A node in the tree
+     * @return TreeNode* The in-order successor, or nullptr if node holds the largest key
+     */
+    TreeNode* successor(TreeNode* node) const;
+
+    /**
+     * @brief Finds the node with the next smaller key, using the parent links
+     *
+     * @param node A node in the tree
+     * @return TreeNode* The in-order predecessor, or nullptr if node holds the smallest key
+     */
+    TreeNode* predecessor(TreeNode* node) const;
+
+    /**
+     * @brief Links nodes[low..high] into a balanced subtree, rooted at the middle node
+     *
+     * Subtree sizes at every node differ by at most one, so all levels above redDepth are full
+     * and the nodes at redDepth, if any, are leaves; coloring those red and the rest black
+     * gives every path the same number of black nodes.
+     *
+     * @param nodeAt Returns the node at a sorted index; called once per index
+     * @param low First index of the subtree
+     * @param high Last index of the subtree
+     * @param parent The subtree root's parent
+     * @param depth Depth of the subtree root
+     * @param redDepth Depth whose nodes are colored red
+     * @return TreeNode* The subtree root, or nullptr if low > high
+     */
+    template <class NodeAt>
+    TreeNode* buildBalanced(NodeAt& nodeAt, int low, int high, TreeNode* parent, int depth, int redDepth) {
+        if (low > high) return nullptr;
+
+        int middle = low + (high - low) / 2;
+        TreeNode* node = nodeAt(middle);
+
+        node->parent = parent;
+        node->left = buildBalanced(nodeAt, low, middle - 1, node, depth + 1, redDepth);
+        node->right = buildBalanced(nodeAt, middle + 1, high, node, depth + 1, redDepth);
+        node->color = (depth == redDepth) ? RED : BLACK;
+        node->height = 0;
+        node->numberOfNodes = high - low + 1;
+
+        return node;
+    }
+
+    /**
+     * @brief Makes a tree from nodes in ascending key order; the tree must be empty
+     *
+     * @param nodeAt Returns the node at a sorted index; called once per index
+     * @param count The number of nodes
+     */
+    template <class NodeAt>
+    void buildFromSorted(NodeAt nodeAt, int count) {
+        // Levels 0 .. fullLevels - 1 hold 2^fullLevels - 1 nodes; any nodes past them form the red level
+        int fullLevels = 0;
+        while ((2LL << fullLevels) - 1 <= count) {
+            fullLevels++;
+        }
+
+        root = buildBalanced(nodeAt, 0, count - 1, nullptr, 0, fullLevels);
+    }
+
+    /**
+     * @brief Counts the keys below key, or at or below it
+     *
+     * @param key The bound
+     * @param inclusive True to count keys <= key, false to count keys < key
+     * @return int The number of keys counted
+     */
+    int countBelow(int key, bool inclusive) const;
+
+    /**
+     * @brief Finds node with specified key
+     *
+     * @param node Root of subtree to search
+     * @param key Key to find
+     * @return TreeNode* Node with key, or nullptr
+     */
+    TreeNode* findNode(TreeNode* node, int key) const;
+
+    /**
+     * @brief Updates node counts for a given node
+     *
+     * @param node Node to update
+     */
+    void updateNodeCounts(TreeNode* node);
+
+    /**
+     * @brief Checks if node is red
+     *
+     * @param node Node to check
+     * @return bool True if red, false if black or null
+     */
+    bool isRed(TreeNode* node) const;
+
+    /**
+     * @brief Gets color of a node
+     *
+     * @param node The node to check
+     * @return Color Color of the node
+     */
+    Color getColor(TreeNode* node) const;
+
+    /**
+     * @brief Sets color of a node
+     *
+     * @param node The node to modify
+     * @param color Color to set
+     */
+    void setColor(TreeNode* node, Color color);
+
+    /**
+     * @brief Fixes Red-Black properties after insertion, walking up from the new node
+     *
+     * @param node Node that was inserted
+     */
+    void fixInsertion(TreeNode* node);
+
+    /**
+     * @brief Fixes Red-Black properties after a black node was unlinked
+     *
+     * @param node Node that took the unlinked node's place (may be nullptr); it carries an extra black
+     * @param parent Parent of node
+     */
+    void fixDeletion(TreeNode* node, TreeNode* parent);
+};
+
 #endif // SELFBALANCING_TREE_H
\ No newline at end of file
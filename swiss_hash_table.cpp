@@ -0,0 +1,542 @@
+/**
+*
+* @file swiss_hash_table.cpp - Implementation of the group-probing (Swiss table) hash table
+*
+* 10/18/26 - Created; 16-slot control-byte groups matched with SSE2, scalar fallback elsewhere
+* 10/18/26 - Added findOrInsert and remove(curKey, removedNode); add probes once
+* 10/18/26 - Control and slot arrays are allocated from the table's memory resource
+* 10/18/26 - Added prefetch
+* 10/18/26 - Added getBytesPerItem
+* 10/18/26 - Lookups are const
+*/
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include "swiss_hash_table.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SWISS_USE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+extern void logToFileAndConsole(std::string msg);
+
+// Control byte values; a full slot stores its 7-bit fingerprint (0..127)
+static const signed char CTRL_EMPTY = -128;
+static const signed char CTRL_DELETED = -2;
+
+// Slots per group, smallest table, and the maximum load factor (MAX_LOAD_NUMERATOR / 8)
+static const int GROUP_WIDTH = 16;
+static const int MIN_CAPACITY = GROUP_WIDTH;
+static const int MAX_LOAD_NUMERATOR = 7;
+
+/**
+*
+* matchByte
+*
+* function to compare the 16 control bytes of a group against value
+*
+* @param    group   first control byte of the group
+* @param    value   control byte to look for
+*
+* @return   bitmask with bit i set when group[i] == value
+*/
+static inline unsigned int matchByte(const signed char* group, signed char value) {
+#ifdef SWISS_USE_SSE2
+    __m128i bytes = _mm_loadu_si128((const __m128i*)group);
+    return (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(value)));
+#else
+    unsigned int mask = 0;
+    for (int i = 0; i < GROUP_WIDTH; i++) {
+        if (group[i] == value) {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+#endif
+}
+
+/**
+*
+* matchEmptyOrDeleted
+*
+* function to find the free slots (EMPTY or DELETED, both negative) of a group
+*
+* @param    group   first control byte of the group
+*
+* @return   bitmask with bit i set when group[i] is not a fingerprint
+*/
+static inline unsigned int matchEmptyOrDeleted(const signed char* group) {
+#ifdef SWISS_USE_SSE2
+    // movemask collects the sign bits, which are set exactly for EMPTY and DELETED
+    return (unsigned int)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)group));
+#else
+    unsigned int mask = 0;
+    for (int i = 0; i < GROUP_WIDTH; i++) {
+        if (group[i] < 0) {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+#endif
+}
+
+/**
+*
+* lowestBit
+*
+* function to return the index of the lowest set bit of a non-zero mask
+*
+* @param    mask    non-zero bitmask
+*
+* @return   index of the lowest set bit
+*/
+static inline int lowestBit(unsigned int mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(mask);
+#else
+    int index = 0;
+    while ((mask & 1u) == 0) {
+        mask >>= 1;
+        index++;
+    }
+    return index;
+#endif
+}
+
+SwissHashTable::SwissHashTable(int hashTableSize, std::pmr::memory_resource* resource) : ctrl(nullptr), slots(nullptr), capacity(0), numberOfItems(0), numberOfDeleted(0), growthLeft(0), memoryResource(resource) {
+    int newCapacity = MIN_CAPACITY;
+    while (newCapacity / 8 * MAX_LOAD_NUMERATOR < hashTableSize) {
+        newCapacity *= 2;
+    }
+
+    allocateSlots(newCapacity);
+}
+
+SwissHashTable::~SwissHashTable() {
+    deallocateArray(memoryResource, ctrl, capacity);
+    deallocateArray(memoryResource, slots, capacity);
+}
+
+/**
+*
+* allocateSlots
+*
+* Method to allocate empty control and slot arrays of newCapacity slots
+*
+* @param    newCapacity   number of slots
+*
+* @return   nothing
+*/
+void SwissHashTable::allocateSlots(int newCapacity) {
+    ctrl = allocateArray<signed char>(memoryResource, newCapacity);
+    std::memset(ctrl, CTRL_EMPTY, newCapacity);
+    slots = allocateArray<SwissSlot>(memoryResource, newCapacity);
+
+    capacity = newCapacity;
+    numberOfDeleted = 0;
+    growthLeft = newCapacity / 8 * MAX_LOAD_NUMERATOR - numberOfItems;
+}
+
+/**
+*
+* rehash
+*
+* Method to move every entry into new arrays of newCapacity slots, dropping tombstones
+*
+* @param    newCapacity   number of slots
+*
+* @return   nothing
+*/
+void SwissHashTable::rehash(int newCapacity) {
+    signed char* oldCtrl = ctrl;
+    SwissSlot* oldSlots = slots;
+    int oldCapacity = capacity;
+
+    allocateSlots(newCapacity);
+
+    for (int i = 0; i < oldCapacity; i++) {
+        if (oldCtrl[i] >= 0) {
+            int index = findInsertSlot(calculateHashCode(oldSlots[i].key));
+            ctrl[index] = oldCtrl[i];
+            slots[index] = oldSlots[i];
+        }
+    }
+
+    deallocateArray(memoryResource, oldCtrl, oldCapacity);
+    deallocateArray(memoryResource, oldSlots, oldCapacity);
+}
+
+/**
+*
+* findSlot
+*
+* Method to find the slot holding curKey
+*
+* @param    curKey    key to look up
+*
+* @return   slot index, or -1 if not found
+*/
+int SwissHashTable::findSlot(int curKey) const {
+    unsigned long long hash = calculateHashCode(curKey);
+    signed char fingerprint = (signed char)(hash & 0x7f);
+    int groupMask = capacity / GROUP_WIDTH - 1;
+    int group = (int)(hash >> 7) & groupMask;
+
+    // Triangular probing over groups visits every group once before repeating
+    for (int step = 1; ; step++) {
+        const signed char* groupCtrl = ctrl + group * GROUP_WIDTH;
+
+        for (unsigned int match = matchByte(groupCtrl, fingerprint); match != 0; match &= match - 1) {
+            int index = group * GROUP_WIDTH + lowestBit(match);
+            if (slots[index].key == curKey) {
+                return index;
+            }
+        }
+
+        // A group with an EMPTY byte was never full, so no key probed past it
+        if (matchByte(groupCtrl, CTRL_EMPTY) != 0) {
+            return -1;
+        }
+
+        group = (group + step) & groupMask;
+    }
+}
+
+/**
+*
+* findInsertSlot
+*
+* Method to find the first EMPTY or DELETED slot on curKey's probe sequence
+*
+* @param    hash    full hash of the key being inserted
+*
+* @return   slot index
+*/
+int SwissHashTable::findInsertSlot(unsigned long long hash) {
+    int groupMask = capacity / GROUP_WIDTH - 1;
+    int group = (int)(hash >> 7) & groupMask;
+
+    for (int step = 1; ; step++) {
+        unsigned int freeSlots = matchEmptyOrDeleted(ctrl + group * GROUP_WIDTH);
+        if (freeSlots != 0) {
+            return group * GROUP_WIDTH + lowestBit(freeSlots);
+        }
+
+        group = (group + step) & groupMask;
+    }
+}
+
+/**
+*
+* getSize
+*
+* Method to return the number of slots
+*
+* @param    none
+*
+* @return	number of slots
+*/
+int SwissHashTable::getSize() {
+    return capacity;
+}
+
+/**
+*
+* calculateHashCode
+*
+* Method to calculate the 64-bit hash of a key; the low 7 bits are the fingerprint,
+* the rest select the first group to probe
+*
+* @param    currentKey     key to hash
+*
+* @return   hash for currentKey
+*/
+unsigned long long SwissHashTable::calculateHashCode(int currentKey) const {
+    // Multiply then fold the high half down so the low bits depend on every key bit
+    unsigned long long hash = (unsigned long long)(unsigned int)currentKey * 0x9E3779B97F4A7C15ull;
+    return hash ^ (hash >> 32);
+}
+
+/**
+*
+* isEmpty
+*
+* Method to check if SwissHashTable is empty
+*
+* @param    none
+*
+* @return   true if the table has zero entries, false otherwise
+*/
+bool SwissHashTable::isEmpty() {
+    return numberOfItems == 0;
+}
+
+/**
+*
+* getNumberOfItems
+*
+* Method to return number of items in the table
+*
+* @param    none
+*
+* @return   number of items in the table
+*/
+int SwissHashTable::getNumberOfItems() {
+    return numberOfItems;
+}
+
+/**
+*
+* add
+*
+* Method to map curKey to myNode, growing the table when it is too full
+*
+* @param    curKey    key for this node
+* @param    myNode    FIFO node the key refers to
+*
+* @return   true if success, false if the key was already present
+*/
+bool SwissHashTable::add(int curKey, DllNode* myNode) {
+    bool inserted;
+    findOrInsert(curKey, myNode, inserted);
+
+    return inserted;
+}
+
+/**
+*
+* findOrInsert
+*
+* Method to look up curKey and, if it is absent, insert it into the first free slot the lookup passed
+*
+* @param    curKey      key to look up or insert
+* @param    myNode      FIFO node to map curKey to if it is absent
+* @param    inserted    set to true if curKey was inserted, false if it was already present
+*
+* @return   the slot's FIFO node pointer for curKey
+*/
+DllNode** SwissHashTable::findOrInsert(int curKey, DllNode* myNode, bool& inserted) {
+    unsigned long long hash = calculateHashCode(curKey);
+    signed char fingerprint = (signed char)(hash & 0x7f);
+    int groupMask = capacity / GROUP_WIDTH - 1;
+    int group = (int)(hash >> 7) & groupMask;
+    int index = -1;
+
+    for (int step = 1; ; step++) {
+        const signed char* groupCtrl = ctrl + group * GROUP_WIDTH;
+
+        for (unsigned int match = matchByte(groupCtrl, fingerprint); match != 0; match &= match - 1) {
+            int candidate = group * GROUP_WIDTH + lowestBit(match);
+            if (slots[candidate].key == curKey) {
+                inserted = false;
+                return &slots[candidate].value;
+            }
+        }
+
+        // Remember the first free slot on the way; the lookup itself must go on to an EMPTY byte
+        if (index == -1) {
+            unsigned int freeSlots = matchEmptyOrDeleted(groupCtrl);
+            if (freeSlots != 0) {
+                index = group * GROUP_WIDTH + lowestBit(freeSlots);
+            }
+        }
+
+        if (matchByte(groupCtrl, CTRL_EMPTY) != 0) {
+            break;
+        }
+
+        group = (group + step) & groupMask;
+    }
+
+    // Reusing a tombstone costs no growth; filling an EMPTY slot may need a rehash first
+    if (ctrl[index] == CTRL_EMPTY && growthLeft == 0) {
+        // Mostly tombstones: rebuild at the same size, otherwise double
+        rehash((numberOfDeleted > capacity / 16) ? capacity : capacity * 2);
+        index = findInsertSlot(hash);
+    }
+
+    if (ctrl[index] == CTRL_EMPTY) {
+        growthLeft--;
+    } else {
+        numberOfDeleted--;
+    }
+
+    ctrl[index] = (signed char)(hash & 0x7f);
+    slots[index].key = curKey;
+    slots[index].value = myNode;
+    numberOfItems++;
+
+    inserted = true;
+    return &slots[index].value;
+}
+
+/**
+*
+* remove
+*
+* Method to remove curKey
+*
+* @param    curKey  key of entry to remove
+*
+* @return   true if success, false otherwise
+*/
+bool SwissHashTable::remove(int curKey) {
+    DllNode* removedNode;
+
+    return remove(curKey, removedNode);
+}
+
+/**
+*
+* remove
+*
+* Method to remove curKey and hand back its FIFO node
+*
+* @param    curKey          key of entry to remove
+* @param    removedNode     set to the FIFO node of the removed entry
+*
+* @return   true if success, false otherwise
+*/
+bool SwissHashTable::remove(int curKey, DllNode*& removedNode) {
+    int index = findSlot(curKey);
+    if (index == -1) {
+        return false;
+    }
+
+    removedNode = slots[index].value;
+
+    // If the group still has an EMPTY byte no probe ever passed it, so the slot can be EMPTY again;
+    // otherwise leave a tombstone so lookups keep probing past this group
+    if (matchByte(ctrl + (index / GROUP_WIDTH) * GROUP_WIDTH, CTRL_EMPTY) != 0) {
+        ctrl[index] = CTRL_EMPTY;
+        growthLeft++;
+    } else {
+        ctrl[index] = CTRL_DELETED;
+        numberOfDeleted++;
+    }
+
+    numberOfItems--;
+    return true;
+}
+
+/**
+*
+* clear
+*
+* Method to remove all entries from the table
+*
+* @param    none
+*
+* @return   nothing
+*/
+void SwissHashTable::clear() {
+    std::memset(ctrl, CTRL_EMPTY, capacity);
+
+    numberOfItems = 0;
+    numberOfDeleted = 0;
+    growthLeft = capacity / 8 * MAX_LOAD_NUMERATOR;
+}
+
+/**
+*
+* getItem
+*
+* Method to retrieve the FIFO node mapped to curKey
+*
+* @param    curKey  key to look up
+*
+* @return   pointer to the DllNode, or nullptr if not found
+*/
+DllNode* SwissHashTable::getItem(int curKey) const {
+    int index = findSlot(curKey);
+
+    return (index == -1) ? nullptr : slots[index].value;
+}
+
+/**
+*
+* contains
+*
+* Method to verify if a key is in the table
+*
+* @param    curKey  key to look up
+*
+* @return   true if found, false otherwise
+*/
+bool SwissHashTable::contains(int curKey) const {
+    return findSlot(curKey) != -1;
+}
+
+/**
+*
+* prefetch
+*
+* Method to start loading the control bytes and first slots of curKey's first group
+*
+* @param    curKey  key that will be looked up soon
+*
+* @return   nothing
+*/
+void SwissHashTable::prefetch(int curKey) const {
+    int groupMask = capacity / GROUP_WIDTH - 1;
+    int group = (int)(calculateHashCode(curKey) >> 7) & groupMask;
+
+    prefetchForRead(ctrl + group * GROUP_WIDTH);
+    prefetchForRead(slots + group * GROUP_WIDTH);
+}
+
+/**
+*
+* getMemoryUsage
+*
+* Method to return the bytes held by the control and slot arrays
+*
+* @param    none
+*
+* @return   bytes used by the table
+*/
+size_t SwissHashTable::getMemoryUsage() {
+    return sizeof(SwissHashTable) + capacity * (sizeof(signed char) + sizeof(SwissSlot));
+}
+
+/**
+*
+* getBytesPerItem
+*
+* Method to return the index storage one item accounts for at the maximum load factor
+*
+* @param    none
+*
+* @return   bytes per item
+*/
+size_t SwissHashTable::getBytesPerItem() {
+    return (sizeof(signed char) + sizeof(SwissSlot)) * 8 / MAX_LOAD_NUMERATOR;
+}
+
+/**
+*
+* printTable
+*
+* Method to print out the contents of table
+*
+* @param    none
+*
+* @return   nothing, but output is sent to console and to file
+*/
+void SwissHashTable::printTable() {
+    for (int i = 0; i < capacity; i++) {
+        if (ctrl[i] < 0) {
+            logToFileAndConsole("Empty slot: " + std::to_string(i));
+        } else {
+            logToFileAndConsole("\nSlot " + std::to_string(i) + ": ");
+
+            if (slots[i].value != nullptr) {
+                slots[i].value->printNode();
+            } else {
+                logToFileAndConsole("Hash slot with key: " + std::to_string(slots[i].key));
+            }
+        }
+    }
+}
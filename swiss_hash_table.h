@@ -0,0 +1,287 @@
+/**
+*
+* swiss_hash_table.h : This is the header file for swiss_hash_table.cpp.
+*
+* 10/18/26 - Created; group-probing hash table with 7-bit control-byte fingerprints (Swiss table layout)
+* 10/18/26 - Added findOrInsert and remove(curKey, removedNode); add probes once
+* 10/18/26 - Control and slot arrays come from an optional std::pmr::memory_resource
+* 10/18/26 - Added prefetch
+* 10/18/26 - Added getBytesPerItem
+* 10/18/26 - Lookups are const
+*/
+
+#ifndef _SWISS_HASH_TABLE
+#define _SWISS_HASH_TABLE
+
+#include "hash_index.h"
+#include "memory_resources.h"
+
+// One slot of the Swiss table; the matching control byte lives in the separate ctrl array
+struct SwissSlot {
+	int key;
+	DllNode* value;
+};
+
+// Define a class for the group-probing hash table
+//
+// Every slot has a control byte: EMPTY, DELETED, or the low 7 bits of the key's hash
+// (its fingerprint) when the slot is full. Slots are probed sixteen at a time: one
+// SSE2 compare of a 16-byte control group against the fingerprint yields a bitmask
+// of candidate slots, and only those keys are compared. A lookup ends at the first
+// group that still has an EMPTY byte, so most misses touch only the control bytes.
+// Without SSE2 the same group matching is done with a scalar loop.
+class SwissHashTable : public HashIndex {
+private:
+	signed char* ctrl;				// one control byte per slot
+	SwissSlot* slots;
+
+	int capacity;					// number of slots, a power-of-two multiple of the group width
+	int numberOfItems;
+	int numberOfDeleted;			// DELETED control bytes (tombstones) still in the table
+	int growthLeft;					// inserts into EMPTY slots allowed before the next rehash
+
+	std::pmr::memory_resource* memoryResource;	// source of control and slot arrays; nullptr = new/delete
+
+	/**
+	*
+	* allocateSlots
+	*
+	* Method to allocate empty control and slot arrays of newCapacity slots
+	*
+	* @param    newCapacity   number of slots
+	*
+	* @return   nothing
+	*/
+	void allocateSlots(int newCapacity);
+
+	/**
+	*
+	* rehash
+	*
+	* Method to move every entry into new arrays of newCapacity slots, dropping tombstones
+	*
+	* @param    newCapacity   number of slots
+	*
+	* @return   nothing
+	*/
+	void rehash(int newCapacity);
+
+	/**
+	*
+	* findSlot
+	*
+	* Method to find the slot holding curKey
+	*
+	* @param    curKey    key to look up
+	*
+	* @return   slot index, or -1 if not found
+	*/
+	int findSlot(int curKey) const;
+
+	/**
+	*
+	* findInsertSlot
+	*
+	* Method to find the first EMPTY or DELETED slot on curKey's probe sequence
+	*
+	* @param    hash    full hash of the key being inserted
+	*
+	* @return   slot index
+	*/
+	int findInsertSlot(unsigned long long hash);
+
+public:
+	// Constructor sizes the table so that hashTableSize entries fit under the maximum load factor;
+	// control and slot arrays come from resource (new/delete if null)
+	SwissHashTable(int hashTableSize, std::pmr::memory_resource* resource = nullptr);
+
+	// Destructor frees the control and slot arrays; FIFO nodes are not owned by the table
+	~SwissHashTable();
+
+	/**
+	*
+	* getSize
+	*
+	* Method to return the number of slots
+	*
+	* @param    none
+	*
+	* @return	number of slots
+	*/
+	int getSize();
+
+	/**
+	*
+	* calculateHashCode
+	*
+	* Method to calculate the 64-bit hash of a key; the low 7 bits are the fingerprint,
+	* the rest select the first group to probe
+	*
+	* @param    currentKey     key to hash
+	*
+	* @return   hash for currentKey
+	*/
+	unsigned long long calculateHashCode(int currentKey) const;
+
+	/**
+	*
+	* isEmpty
+	*
+	* Method to check if SwissHashTable is empty
+	*
+	* @param    none
+	*
+	* @return   true if the table has zero entries, false otherwise
+	*/
+	bool isEmpty();
+
+	/**
+	*
+	* getNumberOfItems
+	*
+	* Method to return number of items in the table
+	*
+	* @param    none
+	*
+	* @return   number of items in the table
+	*/
+	int getNumberOfItems();
+
+	/**
+	*
+	* add
+	*
+	* Method to map curKey to myNode, growing the table when it is too full
+	*
+	* @param    curKey    key for this node
+	* @param    myNode    FIFO node the key refers to
+	*
+	* @return   true if success, false if the key was already present
+	*/
+	bool add(int curKey, DllNode* myNode);
+
+	/**
+	*
+	* findOrInsert
+	*
+	* Method to look up curKey and, if it is absent, insert it into the first free slot the lookup passed
+	*
+	* @param    curKey      key to look up or insert
+	* @param    myNode      FIFO node to map curKey to if it is absent
+	* @param    inserted    set to true if curKey was inserted, false if it was already present
+	*
+	* @return   the slot's FIFO node pointer for curKey
+	*/
+	DllNode** findOrInsert(int curKey, DllNode* myNode, bool& inserted);
+
+	/**
+	*
+	* remove
+	*
+	* Method to remove curKey
+	*
+	* @param    curKey  key of entry to remove
+	*
+	* @return   true if success, false otherwise
+	*/
+	bool remove(int curKey);
+
+	/**
+	*
+	* remove
+	*
+	* Method to remove curKey and hand back its FIFO node
+	*
+	* @param    curKey          key of entry to remove
+	* @param    removedNode     set to the FIFO node of the removed entry
+	*
+	* @return   true if success, false otherwise
+	*/
+	bool remove(int curKey, DllNode*& removedNode);
+
+	/**
+	*
+	* clear
+	*
+	* Method to remove all entries from the table
+	*
+	* @param    none
+	*
+	* @return   nothing
+	*/
+	void clear();
+
+	/**
+	*
+	* getItem
+	*
+	* Method to retrieve the FIFO node mapped to curKey
+	*
+	* @param    curKey  key to look up
+	*
+	* @return   pointer to the DllNode, or nullptr if not found
+	*/
+	DllNode* getItem(int curKey) const;
+
+	/**
+	*
+	* contains
+	*
+	* Method to verify if a key is in the table
+	*
+	* @param    curKey  key to look up
+	*
+	* @return   true if found, false otherwise
+	*/
+	bool contains(int curKey) const;
+
+	/**
+	*
+	* prefetch
+	*
+	* Method to start loading the control bytes and first slots of curKey's first group
+	*
+	* @param    curKey  key that will be looked up soon
+	*
+	* @return   nothing
+	*/
+	void prefetch(int curKey) const;
+
+	/**
+	*
+	* getMemoryUsage
+	*
+	* Method to return the bytes held by the control and slot arrays
+	*
+	* @param    none
+	*
+	* @return   bytes used by the table
+	*/
+	size_t getMemoryUsage();
+
+	/**
+	*
+	* getBytesPerItem
+	*
+	* Method to return the index storage one item accounts for at the maximum load factor
+	*
+	* @param    none
+	*
+	* @return   bytes per item
+	*/
+	size_t getBytesPerItem();
+
+	/**
+	*
+	* printTable
+	*
+	* Method to print out the contents of table
+	*
+	* @param    none
+	*
+	* @return   nothing, but output is sent to console and to file
+	*/
+	void printTable();
+};
+
+#endif
@@ -0,0 +1,219 @@
+/**
+*
+* @file timer_wheel.cpp - Implementation of the hierarchical timing wheel
+*
+* 10/18/26 - Created
+*/
+
+#include <algorithm>
+#include <chrono>
+#include "timer_wheel.h"
+
+/**
+*
+* steadyClockMilliseconds
+*
+* function to return std::chrono::steady_clock's current time in milliseconds
+*
+* @param    none
+*
+* @return   milliseconds since the steady clock's epoch
+*/
+long long steadyClockMilliseconds() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+TimerWheel::TimerWheel(long long startTime, std::pmr::memory_resource* resource) : currentTime(startTime), size(0), memoryResource(resource) {
+    buckets = allocateArray<CacheEntry*>(memoryResource, LEVELS * SLOTS);
+    std::fill(buckets, buckets + LEVELS * SLOTS, nullptr);
+}
+
+TimerWheel::~TimerWheel() {
+    deallocateArray(memoryResource, buckets, LEVELS * SLOTS);
+}
+
+/**
+*
+* place
+*
+* Method to link an entry into the bucket for its deadline, on the lowest level whose span
+* from currentTime reaches it
+*
+* @param    entry   entry with expiresAt set, not in any bucket
+*
+* @return   nothing
+*/
+void TimerWheel::place(CacheEntry* entry) {
+    // A deadline already passed goes in the next tick's bucket; one beyond the top level's
+    // span goes in the top level's last bucket and is placed again when that comes around
+    const long long span = 1LL << (LEVELS * SLOT_BITS);
+    long long delta = std::min(std::max(entry->expiresAt - currentTime, 1LL), span - 1);
+    long long due = currentTime + delta;
+
+    int level = 0;
+    while (level < LEVELS - 1 && (delta >> ((level + 1) * SLOT_BITS)) != 0) {
+        level++;
+    }
+
+    // delta is at least one bucket of this level, so the bucket is ahead of the one currentTime is in
+    int bucket = level * SLOTS + (int)((due >> (level * SLOT_BITS)) & (SLOTS - 1));
+
+    entry->timerBucket = bucket;
+    entry->timerPrev = nullptr;
+    entry->timerNext = buckets[bucket];
+    if (buckets[bucket] != nullptr) {
+        buckets[bucket]->timerPrev = entry;
+    }
+    buckets[bucket] = entry;
+}
+
+/**
+*
+* unlink
+*
+* Method to take an entry out of its bucket
+*
+* @param    entry   an entry in a bucket
+*
+* @return   nothing
+*/
+void TimerWheel::unlink(CacheEntry* entry) {
+    if (entry->timerPrev != nullptr) {
+        entry->timerPrev->timerNext = entry->timerNext;
+    } else {
+        buckets[entry->timerBucket] = entry->timerNext;
+    }
+
+    if (entry->timerNext != nullptr) {
+        entry->timerNext->timerPrev = entry->timerPrev;
+    }
+
+    entry->timerPrev = nullptr;
+    entry->timerNext = nullptr;
+    entry->timerBucket = -1;
+}
+
+/**
+*
+* getSize
+*
+* Method to return the number of scheduled entries
+*
+* @param    none
+*
+* @return   number of entries
+*/
+int TimerWheel::getSize() {
+    return size;
+}
+
+/**
+*
+* schedule
+*
+* Method to schedule an entry to expire at its expiresAt; an entry that is already
+* scheduled is moved to its new deadline
+*
+* @param    entry   entry with expiresAt set
+*
+* @return   nothing
+*/
+void TimerWheel::schedule(CacheEntry* entry) {
+    if (entry->timerBucket >= 0) {
+        unlink(entry);
+    } else {
+        size++;
+    }
+
+    place(entry);
+}
+
+/**
+*
+* cancel
+*
+* Method to unschedule an entry
+*
+* @param    entry   a scheduled entry
+*
+* @return   nothing
+*/
+void TimerWheel::cancel(CacheEntry* entry) {
+    unlink(entry);
+    size--;
+}
+
+/**
+*
+* advance
+*
+* Method to move the wheel's time forward to now and unschedule every entry that is due
+*
+* @param    now     current time in milliseconds; a time behind the wheel's does nothing
+*
+* @return   the entries whose expiresAt is at or before now, linked through timerNext,
+*           or nullptr if there are none
+*/
+CacheEntry* TimerWheel::advance(long long now) {
+    if (now <= currentTime) {
+        return nullptr;
+    }
+
+    long long previousTime = currentTime;
+    currentTime = now;
+
+    CacheEntry* expired = nullptr;
+
+    // Finer levels first: entries moving down from a coarser level are due after now, so
+    // the buckets they land in are never ones this call still has to empty
+    for (int level = 0; level < LEVELS; level++) {
+        int shift = level * SLOT_BITS;
+        long long previousTicks = previousTime >> shift;
+        long long ticks = std::min((now >> shift) - previousTicks, (long long)SLOTS);
+
+        // A coarser level only turns over when the finer one wraps
+        if (ticks == 0) {
+            break;
+        }
+
+        for (long long tick = previousTicks + 1; tick <= previousTicks + ticks; tick++) {
+            int bucket = level * SLOTS + (int)(tick & (SLOTS - 1));
+            CacheEntry* entry = buckets[bucket];
+            buckets[bucket] = nullptr;
+
+            while (entry != nullptr) {
+                CacheEntry* next = entry->timerNext;
+
+                if (entry->expiresAt <= now) {
+                    entry->timerBucket = -1;
+                    entry->timerPrev = nullptr;
+                    entry->timerNext = expired;
+                    expired = entry;
+                    size--;
+                } else {
+                    place(entry);
+                }
+
+                entry = next;
+            }
+        }
+    }
+
+    return expired;
+}
+
+/**
+*
+* clear
+*
+* Method to unschedule every entry without looking at them; the entries must not be used
+* with this wheel again unless their timerBucket is reset
+*
+* @param    none
+*
+* @return   nothing
+*/
+void TimerWheel::clear() {
+    std::fill(buckets, buckets + LEVELS * SLOTS, nullptr);
+    size = 0;
+}
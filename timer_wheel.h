@@ -0,0 +1,148 @@
+/**
+*
+* timer_wheel.h : This is the header file for timer_wheel.cpp.
+*
+* 10/18/26 - Created; hierarchical timing wheel of cache entry expirations, and the default cache clock
+*/
+
+#ifndef _TIMER_WHEEL
+#define _TIMER_WHEEL
+
+#include "cache_entry.h"
+#include "memory_resources.h"
+
+// Returns the current time in milliseconds; CacheManager reads it to set and check entry deadlines
+typedef long long (*CacheClock)();
+
+/**
+*
+* steadyClockMilliseconds
+*
+* function to return std::chrono::steady_clock's current time in milliseconds
+*
+* @param    none
+*
+* @return   milliseconds since the steady clock's epoch
+*/
+long long steadyClockMilliseconds();
+
+// Define a class that finds expired cache entries without scanning the cache
+//
+// LEVELS wheels of SLOTS buckets each. A bucket on level 0 covers one millisecond,
+// a bucket on level n covers SLOTS times as long as one on level n - 1, so the five
+// levels reach about twelve days ahead; an entry due later sits in the top level and
+// is placed again whenever its bucket comes around. An entry goes on the lowest level
+// whose span covers its deadline. Advancing the wheel empties the buckets whose time
+// has come: entries that are due are handed back, the rest move down to a finer level.
+// Every entry moves down at most LEVELS - 1 times, so scheduling, cancelling and
+// expiring are O(1) amortized. Buckets are doubly linked through the entries' timer
+// fields, and each entry records its bucket, so cancelling does not search.
+class TimerWheel {
+private:
+	static const int LEVELS = 5;
+	static const int SLOT_BITS = 6;
+	static const int SLOTS = 1 << SLOT_BITS;	// buckets per level
+
+	CacheEntry** buckets;			// LEVELS * SLOTS list heads, level by level
+	long long currentTime;			// time the wheel has been advanced to, in milliseconds
+	int size;
+
+	std::pmr::memory_resource* memoryResource;	// source of the bucket array; nullptr = new/delete
+
+	/**
+	*
+	* place
+	*
+	* Method to link an entry into the bucket for its deadline, on the lowest level whose span
+	* from currentTime reaches it
+	*
+	* @param    entry   entry with expiresAt set, not in any bucket
+	*
+	* @return   nothing
+	*/
+	void place(CacheEntry* entry);
+
+	/**
+	*
+	* unlink
+	*
+	* Method to take an entry out of its bucket
+	*
+	* @param    entry   an entry in a bucket
+	*
+	* @return   nothing
+	*/
+	void unlink(CacheEntry* entry);
+
+public:
+	// Constructor starts the wheel at startTime; the bucket array comes from resource (new/delete if null)
+	TimerWheel(long long startTime, std::pmr::memory_resource* resource = nullptr);
+
+	// Destructor frees the bucket array; the entries are not owned by the wheel
+	~TimerWheel();
+
+	/**
+	*
+	* getSize
+	*
+	* Method to return the number of scheduled entries
+	*
+	* @param    none
+	*
+	* @return   number of entries
+	*/
+	int getSize();
+
+	/**
+	*
+	* schedule
+	*
+	* Method to schedule an entry to expire at its expiresAt; an entry that is already
+	* scheduled is moved to its new deadline
+	*
+	* @param    entry   entry with expiresAt set
+	*
+	* @return   nothing
+	*/
+	void schedule(CacheEntry* entry);
+
+	/**
+	*
+	* cancel
+	*
+	* Method to unschedule an entry
+	*
+	* @param    entry   a scheduled entry
+	*
+	* @return   nothing
+	*/
+	void cancel(CacheEntry* entry);
+
+	/**
+	*
+	* advance
+	*
+	* Method to move the wheel's time forward to now and unschedule every entry that is due
+	*
+	* @param    now     current time in milliseconds; a time behind the wheel's does nothing
+	*
+	* @return   the entries whose expiresAt is at or before now, linked through timerNext,
+	*           or nullptr if there are none
+	*/
+	CacheEntry* advance(long long now);
+
+	/**
+	*
+	* clear
+	*
+	* Method to unschedule every entry without looking at them; the entries must not be used
+	* with this wheel again unless their timerBucket is reset
+	*
+	* @param    none
+	*
+	* @return   nothing
+	*/
+	void clear();
+};
+
+#endif